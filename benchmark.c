@@ -0,0 +1,1285 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "linked_list.h"
+#include "linked_list_typed.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+
+// Generic Linked List Library - Benchmarks
+// Build and run with: make bench  (or ./benchmark full to also time the old sort at 100K)
+// Every run uses the same pseudo-random input so results are comparable between builds.
+
+// The old bubble sort is O(n^2): 100K elements already take minutes, so by default it only
+// runs on the small sizes. Pass "full" on the command line to include the 100K run.
+#define BUBBLE_SORT_LIMIT      1000
+#define BUBBLE_SORT_FULL_LIMIT 100000
+
+static size_t bubble_sort_limit = BUBBLE_SORT_LIMIT;
+
+// Helper function prototypes
+void banner(const char* title);
+double now_seconds(void);
+unsigned int next_random(unsigned int* state);
+int compare_int(const void* a, const void* b);
+LinkedList* build_random_int_list(size_t n, unsigned int seed);
+bool is_sorted_int_list(const LinkedList* list);
+ListResult bubble_sort_reference(LinkedList* list, CompareFunction compare_fn);
+void bench_sort(size_t n);
+double run_churn(LinkedList* list, size_t operations);
+void bench_churn(size_t operations);
+double time_destroy(LinkedList* list, size_t n);
+void bench_teardown(size_t n);
+void bench_sequential_get(size_t n);
+double run_random_access(LinkedList* list, size_t operations);
+void bench_random_access(size_t n, size_t operations);
+size_t hash_int(const void* data);
+void bench_unique(size_t n);
+bool is_even_int(const void* data);
+void square_int_to_long(void* dest, const void* src);
+bool is_large_long(const void* data);
+void bench_pipeline(size_t n);
+bool is_negative_int(const void* data);
+void run_storage_workload(LinkedList* list, size_t n, double* times);
+double run_middle_inserts(LinkedList* list, size_t n, size_t inserts);
+void bench_storage(size_t n, size_t middle_n, size_t middle_inserts);
+int compare_double(const void* a, const void* b);
+bool equals_int_target(const void* data);
+bool equals_double_target(const void* data);
+void bench_typed(size_t n, size_t searches);
+bool double_in_range(const void* data);
+bool double_above_threshold(const void* data);
+bool double_is_missing(const void* data);
+void sum_double(void* accumulator, const void* element);
+void bench_numeric(LinkedList* list, const char* label);
+int compare_record_id(const void* a, const void* b);
+LinkedList* build_record_list(size_t n, LinkedList* list);
+bool is_sorted_by_id(const LinkedList* list);
+void bench_radix(size_t n);
+int compare_record_age(const void* a, const void* b);
+void bench_parallel_sort(size_t n);
+int compare_record_age_descending(const void* a, const void* b);
+bool same_records(const LinkedList* a, const LinkedList* b, size_t count);
+void bench_selection(size_t n, size_t k);
+bool write_legacy_binary(const LinkedList* list, const char* filename);
+void bench_binary_files(size_t n);
+ListResult save_text_reference(const LinkedList* list, const char* filename);
+bool same_file_contents(const char* first, const char* second);
+void bench_text_save(size_t n);
+LinkedList* load_text_reference(const char* filename, size_t element_size);
+bool same_elements(LinkedList* a, LinkedList* b);
+void bench_text_load(size_t n);
+LinkedList* load_separated_reference(const char* filename, size_t element_size, const char* separator,
+                                     size_t* peak_bytes);
+void bench_separated_load(size_t n);
+
+// Export-style record for the radix sort benchmark (sorted by id)
+typedef struct {
+    int id;
+    int age;
+    double score;
+} Record;
+
+// Typed lists for the generic vs. typed comparison
+LL_DEFINE_TYPED_LIST(IntList, int, LL_COMPARE_VALUES(*a, *b))
+LL_DEFINE_TYPED_LIST(DoubleList, double, LL_COMPARE_VALUES(*a, *b))
+
+// Implementation of helper functions
+void banner(const char* title) {
+    printf("\n\n============= %s =============\n", title);
+}
+
+double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// xorshift32 - fast and reproducible, good enough for benchmark input
+unsigned int next_random(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+LinkedList* build_random_int_list(size_t n, unsigned int seed) {
+    LinkedList* list = create_list(sizeof(int));
+    if (!list) return NULL;
+
+    unsigned int state = seed;
+    for (size_t i = 0; i < n; i++) {
+        int value = (int)(next_random(&state) % 1000000);
+        if (insert_tail_value_internal(list, &value) != LIST_SUCCESS) {
+            destroy(list);
+            return NULL;
+        }
+    }
+    return list;
+}
+
+bool is_sorted_int_list(const LinkedList* list) {
+    Node* current = list->head->next;
+    while (current != list->tail && current->next != list->tail) {
+        if (compare_int(current->data, current->next->data) > 0) return false;
+        current = current->next;
+    }
+    return true;
+}
+
+// The sort_list implementation shipped before the merge sort (kept here only for comparison).
+ListResult bubble_sort_reference(LinkedList* list, CompareFunction compare_fn) {
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!compare_fn) return LIST_ERROR_NO_COMPARE_FUNCTION;
+    if (list->length <= 1) return LIST_SUCCESS;
+
+    bool swapped;
+    do {
+        swapped = false;
+        Node* current = list->head->next;
+
+        while (current->next != list->tail) {
+            Node* next_node = current->next;
+            if (compare_fn(current->data, next_node->data) > 0) {
+                // Swap the element bytes so the reference works for any node layout
+                char temp[sizeof(int)];
+                memcpy(temp, current->data, sizeof(int));
+                memcpy(current->data, next_node->data, sizeof(int));
+                memcpy(next_node->data, temp, sizeof(int));
+                swapped = true;
+            }
+            current = next_node;
+        }
+    } while (swapped);
+
+    return LIST_SUCCESS;
+}
+
+void bench_sort(size_t n) {
+    printf("n = %zu\n", n);
+
+    LinkedList* list = build_random_int_list(n, 12345u);
+    if (!list) {
+        printf("  failed to build list\n");
+        return;
+    }
+    double start = now_seconds();
+    sort_list(list, compare_int);
+    double merge_time = now_seconds() - start;
+    printf("  sort_list (merge sort): %10.4f s  %s\n", merge_time,
+           is_sorted_int_list(list) ? "[sorted]" : "[NOT SORTED]");
+    destroy(list);
+
+    if (n > bubble_sort_limit) {
+        printf("  bubble sort (old):      skipped (O(n^2) above %zu elements)\n", bubble_sort_limit);
+        return;
+    }
+
+    list = build_random_int_list(n, 12345u);
+    if (!list) {
+        printf("  failed to build list\n");
+        return;
+    }
+    start = now_seconds();
+    bubble_sort_reference(list, compare_int);
+    double bubble_time = now_seconds() - start;
+    printf("  bubble sort (old):      %10.4f s  %s  (%.1fx slower)\n", bubble_time,
+           is_sorted_int_list(list) ? "[sorted]" : "[NOT SORTED]",
+           merge_time > 0 ? bubble_time / merge_time : 0.0);
+    destroy(list);
+}
+
+// Queue-like churn: keep ~1000 elements alive while pushing at the tail and popping at the head
+double run_churn(LinkedList* list, size_t operations) {
+    unsigned int state = 777u;
+    double start = now_seconds();
+    for (size_t i = 0; i < operations; i++) {
+        int value = (int)i;
+        insert_tail_value_internal(list, &value);
+        if (list->length > 1000 || (next_random(&state) & 1)) {
+            delete_head(list);
+        }
+    }
+    return now_seconds() - start;
+}
+
+void bench_churn(size_t operations) {
+    printf("operations = %zu\n", operations);
+
+    LinkedList* plain = create_list(sizeof(int));
+    LinkedList* pooled = create_list(sizeof(int));
+    if (!plain || !pooled || list_enable_pool(pooled, 0) != LIST_SUCCESS) {
+        printf("  failed to create lists\n");
+        destroy(plain);
+        destroy(pooled);
+        return;
+    }
+
+    // Warm up outside the timing: the first large malloc after the 10M sort run pays for
+    // glibc consolidating millions of freed chunks, which has nothing to do with either list
+    run_churn(plain, 10000);
+    run_churn(pooled, 10000);
+
+    double plain_time = run_churn(plain, operations);
+    double pooled_time = run_churn(pooled, operations);
+    printf("  malloc/free per node:   %10.4f s\n", plain_time);
+    printf("  node pool:              %10.4f s  (%.1fx faster)\n", pooled_time,
+           pooled_time > 0 ? plain_time / pooled_time : 0.0);
+
+    destroy(plain);
+    destroy(pooled);
+}
+
+// Fills the list with n ints and returns the seconds spent in destroy()
+double time_destroy(LinkedList* list, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int value = (int)i;
+        if (insert_tail_value_internal(list, &value) != LIST_SUCCESS) break;
+    }
+    double start = now_seconds();
+    destroy(list);
+    return now_seconds() - start;
+}
+
+void bench_teardown(size_t n) {
+    printf("n = %zu\n", n);
+
+    LinkedList* plain = create_list(sizeof(int));
+    if (!plain) return;
+    double plain_time = time_destroy(plain, n);
+    printf("  destroy (malloc nodes): %10.4f s\n", plain_time);
+
+    LinkedList* pooled = create_list(sizeof(int));
+    if (!pooled) return;
+    list_enable_pool(pooled, 0);
+    double pooled_time = time_destroy(pooled, n);
+    printf("  destroy (node pool):    %10.4f s\n", pooled_time);
+}
+
+// Sequential index loop: quadratic without the finger, linear with it
+void bench_sequential_get(size_t n) {
+    printf("n = %zu\n", n);
+
+    LinkedList* list = build_random_int_list(n, 99u);
+    if (!list) return;
+    list_reset_finger_stats(list);
+
+    long long sum = 0;
+    double start = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        sum += *(int*)get(list, i);
+    }
+    double elapsed = now_seconds() - start;
+
+    ListFingerStats stats;
+    list_finger_stats(list, &stats);
+    printf("  for (i...) get(list, i): %9.4f s  (finger hit rate %.1f%%, checksum %lld)\n",
+           elapsed, stats.hit_rate * 100.0, sum);
+    destroy(list);
+}
+
+// Random positions: a third each of get(), insert_index and delete_index
+double run_random_access(LinkedList* list, size_t operations) {
+    unsigned int state = 4242u;
+    long long sum = 0;
+    double start = now_seconds();
+    for (size_t i = 0; i < operations; i++) {
+        size_t index = next_random(&state) % list->length;
+        switch (i % 3) {
+            case 0: sum += *(int*)get(list, index); break;
+            case 1: { int value = (int)i; insert_index_value_internal(list, index, &value); break; }
+            default: delete_index(list, index); break;
+        }
+    }
+    double elapsed = now_seconds() - start;
+    if (sum == 42) printf(" "); // Keeps the reads from being optimized away
+    return elapsed;
+}
+
+void bench_random_access(size_t n, size_t operations) {
+    printf("n = %zu, operations = %zu\n", n, operations);
+
+    LinkedList* plain = build_random_int_list(n, 7u);
+    LinkedList* indexed = build_random_int_list(n, 7u);
+    if (!plain || !indexed || list_enable_index(indexed) != LIST_SUCCESS) {
+        printf("  failed to build lists\n");
+        destroy(plain);
+        destroy(indexed);
+        return;
+    }
+
+    double plain_time = run_random_access(plain, operations);
+    double indexed_time = run_random_access(indexed, operations);
+
+    ListIndexStats stats;
+    list_index_stats(indexed, &stats);
+    printf("  walk (head/tail/finger): %9.4f s\n", plain_time);
+    printf("  skip-list index:         %9.4f s  (%.1fx faster, %.1f bytes/element)\n", indexed_time,
+           indexed_time > 0 ? plain_time / indexed_time : 0.0, stats.bytes_per_element);
+
+    destroy(plain);
+    destroy(indexed);
+}
+
+size_t hash_int(const void* data) {
+    return (size_t)*(const int*)data;
+}
+
+void bench_unique(size_t n) {
+    printf("n = %zu\n", n);
+
+    LinkedList* list = build_random_int_list(n, 31337u);
+    if (!list) return;
+
+    double start = now_seconds();
+    LinkedList* hashed = unique_hashed(list, hash_int, compare_int);
+    double hashed_time = now_seconds() - start;
+    printf("  unique_hashed:          %10.4f s  (%zu unique)\n", hashed_time, hashed ? hashed->length : 0);
+    destroy(hashed);
+
+    if (n <= 20000) {
+        start = now_seconds();
+        LinkedList* scanned = unique(list, compare_int);
+        double scan_time = now_seconds() - start;
+        printf("  unique (nested scan):   %10.4f s  (%.1fx slower)\n", scan_time,
+               hashed_time > 0 ? scan_time / hashed_time : 0.0);
+        destroy(scanned);
+    } else {
+        printf("  unique (nested scan):   skipped (O(n^2) above 20000 elements)\n");
+    }
+    destroy(list);
+}
+
+bool is_even_int(const void* data) {
+    return (*(const int*)data & 1) == 0;
+}
+
+void square_int_to_long(void* dest, const void* src) {
+    long long value = *(const int*)src;
+    *(long long*)dest = value * value;
+}
+
+bool is_large_long(const void* data) {
+    return *(const long long*)data > 250000000000LL;
+}
+
+// filter -> map -> count: eager (two intermediate lists) vs. one fused pass
+void bench_pipeline(size_t n) {
+    printf("n = %zu\n", n);
+
+    LinkedList* list = build_random_int_list(n, 2024u);
+    if (!list) return;
+
+    double start = now_seconds();
+    LinkedList* evens = filter(list, is_even_int);
+    LinkedList* squares = map(evens, square_int_to_long, sizeof(long long));
+    size_t eager_count = count_matching(squares, is_large_long);
+    double eager_time = now_seconds() - start;
+    destroy(evens);
+    destroy(squares);
+
+    start = now_seconds();
+    ListPipeline* pipeline = pipeline_from_list(list);
+    pipeline_filter(pipeline, is_even_int);
+    pipeline_map(pipeline, square_int_to_long, sizeof(long long));
+    pipeline_filter(pipeline, is_large_long);
+    size_t fused_count = pipeline_count(pipeline);
+    double fused_time = now_seconds() - start;
+    pipeline_destroy(pipeline);
+
+    printf("  filter + map + count_matching: %9.4f s  (count %zu)\n", eager_time, eager_count);
+    printf("  pipeline (single pass):        %9.4f s  (count %zu, %.1fx faster)\n", fused_time, fused_count,
+           fused_time > 0 ? eager_time / fused_time : 0.0);
+    destroy(list);
+}
+
+bool is_negative_int(const void* data) {
+    return *(const int*)data < 0;
+}
+
+// Append n ints, then scan, search, copy out and sort; times[] receives the five durations
+void run_storage_workload(LinkedList* list, size_t n, double* times) {
+    unsigned int state = 555u;
+
+    double start = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int value = (int)(next_random(&state) % 1000000);
+        insert_tail_value_internal(list, &value);
+    }
+    times[0] = now_seconds() - start;
+
+    start = now_seconds();
+    size_t evens = count_matching(list, is_even_int);
+    times[1] = now_seconds() - start;
+
+    start = now_seconds();
+    int missing = index_of(list, is_negative_int); // Never found: a full scan
+    times[2] = now_seconds() - start;
+
+    start = now_seconds();
+    size_t size;
+    int* array = to_array(list, &size);
+    times[3] = now_seconds() - start;
+    if (evens == 42 && missing == 42 && array && array[0] == 42) printf(" "); // Keeps the results alive
+    free(array);
+
+    start = now_seconds();
+    sort_list(list, compare_int);
+    times[4] = now_seconds() - start;
+}
+
+// Inserts at random positions of an n-element list
+double run_middle_inserts(LinkedList* list, size_t n, size_t inserts) {
+    for (size_t i = 0; i < n; i++) {
+        int value = (int)i;
+        insert_tail_value_internal(list, &value);
+    }
+
+    unsigned int state = 8080u;
+    double start = now_seconds();
+    for (size_t i = 0; i < inserts; i++) {
+        int value = (int)i;
+        insert_index_value_internal(list, next_random(&state) % list->length, &value);
+    }
+    return now_seconds() - start;
+}
+
+void bench_storage(size_t n, size_t middle_n, size_t middle_inserts) {
+    printf("n = %zu\n", n);
+
+    const char* names[3] = { "nodes", "contiguous", "unrolled" };
+    double times[3][6];
+
+    for (int s = 0; s < 3; s++) {
+        LinkedList* lists[2];
+        for (int k = 0; k < 2; k++) {
+            lists[k] = s == 0 ? create_list(sizeof(int))
+                     : s == 1 ? create_list_contiguous(sizeof(int))
+                              : create_list_unrolled(sizeof(int), 0);
+        }
+        if (!lists[0] || !lists[1]) {
+            printf("  failed to create lists\n");
+            destroy(lists[0]);
+            destroy(lists[1]);
+            return;
+        }
+        run_storage_workload(lists[0], n, times[s]);
+        times[s][5] = run_middle_inserts(lists[1], middle_n, middle_inserts);
+        destroy(lists[0]);
+        destroy(lists[1]);
+    }
+
+    const char* steps[6] = { "append", "count_matching", "index_of (miss)", "to_array", "sort_list", "insert_index" };
+    printf("  %-16s %11s %11s %11s\n", "", names[0], names[1], names[2]);
+    for (int i = 0; i < 6; i++) {
+        printf("  %-16s %10.4fs %10.4fs %10.4fs\n", steps[i], times[0][i], times[1][i], times[2][i]);
+    }
+    printf("  (insert_index: %zu inserts at random positions of a %zu-element list)\n", middle_inserts, middle_n);
+}
+
+int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// index_of() takes a plain predicate, so the generic searches compare against these
+static int int_target;
+static double double_target;
+
+bool equals_int_target(const void* data) {
+    return *(const int*)data == int_target;
+}
+
+bool equals_double_target(const void* data) {
+    return *(const double*)data == double_target;
+}
+
+// Same random input in a generic list and a typed list; sort both, then look up 'searches' values
+void bench_typed(size_t n, size_t searches) {
+    printf("n = %zu, %zu searches\n", n, searches);
+
+    LinkedList* generic_ints = create_list(sizeof(int));
+    LinkedList* generic_doubles = create_list(sizeof(double));
+    IntList* typed_ints = IntList_create();
+    DoubleList* typed_doubles = DoubleList_create();
+    if (!generic_ints || !generic_doubles || !typed_ints || !typed_doubles) {
+        printf("  failed to create lists\n");
+        destroy(generic_ints);
+        destroy(generic_doubles);
+        IntList_destroy(typed_ints);
+        DoubleList_destroy(typed_doubles);
+        return;
+    }
+
+    // One list at a time, so each list's nodes sit next to each other in memory
+    unsigned int state = 2024u;
+    for (int pass = 0; pass < 4; pass++) {
+        state = 2024u;
+        for (size_t i = 0; i < n; i++) {
+            int value = (int)(next_random(&state) % (unsigned int)(n * 2));
+            double real = value / 3.0;
+            if (pass == 0) insert_tail_value_internal(generic_ints, &value);
+            if (pass == 1) insert_tail_value_internal(generic_doubles, &real);
+            if (pass == 2) IntList_insert_tail(typed_ints, value);
+            if (pass == 3) DoubleList_insert_tail(typed_doubles, real);
+        }
+    }
+
+    double times[2][4];
+
+    // Searches for random values (about half are missing and scan the whole list), run while
+    // both lists are still in allocation order so they measure the loops, not cache misses
+    double start;
+    bool same = true;
+    state = 99u;
+    times[0][2] = times[1][2] = times[0][3] = times[1][3] = 0.0;
+    for (size_t i = 0; i < searches; i++) {
+        int_target = (int)(next_random(&state) % (unsigned int)(n * 2));
+        double_target = int_target / 3.0;
+
+        start = now_seconds();
+        int generic_index = index_of(generic_ints, equals_int_target);
+        times[0][2] += now_seconds() - start;
+        start = now_seconds();
+        int typed_index = IntList_find(typed_ints, int_target);
+        times[1][2] += now_seconds() - start;
+        same = same && (generic_index == typed_index);
+
+        start = now_seconds();
+        generic_index = index_of(generic_doubles, equals_double_target);
+        times[0][3] += now_seconds() - start;
+        start = now_seconds();
+        typed_index = DoubleList_find(typed_doubles, double_target);
+        times[1][3] += now_seconds() - start;
+        same = same && (generic_index == typed_index);
+    }
+
+    start = now_seconds();
+    sort_list(generic_ints, compare_int);
+    times[0][0] = now_seconds() - start;
+    start = now_seconds();
+    IntList_sort(typed_ints);
+    times[1][0] = now_seconds() - start;
+
+    start = now_seconds();
+    sort_list(generic_doubles, compare_double);
+    times[0][1] = now_seconds() - start;
+    start = now_seconds();
+    DoubleList_sort(typed_doubles);
+    times[1][1] = now_seconds() - start;
+
+    const char* steps[4] = { "sort int", "sort double", "find int", "find double" };
+    printf("  %-12s %11s %11s %9s\n", "", "generic", "typed", "speedup");
+    for (int i = 0; i < 4; i++) {
+        double speedup = times[1][i] > 0 ? times[0][i] / times[1][i] : 0.0;
+        printf("  %-12s %10.4fs %10.4fs %8.1fx\n", steps[i], times[0][i], times[1][i], speedup);
+    }
+    printf("  results match: %s\n", same ? "yes" : "NO");
+
+    destroy(generic_ints);
+    destroy(generic_doubles);
+    IntList_destroy(typed_ints);
+    DoubleList_destroy(typed_doubles);
+}
+
+// Generic counterparts of the numeric kernels: values in [0, 100], above 990, never present
+bool double_in_range(const void* data) {
+    double x = *(const double*)data;
+    return x >= 0.0 && x <= 100.0;
+}
+
+bool double_above_threshold(const void* data) {
+    return *(const double*)data > 990.0;
+}
+
+bool double_is_missing(const void* data) {
+    return *(const double*)data == -1.0;
+}
+
+void sum_double(void* accumulator, const void* element) {
+    *(double*)accumulator += *(const double*)element;
+}
+
+// Times the generic path (predicates / compare functions) and every kernel level on one double list
+void bench_numeric(LinkedList* list, const char* label) {
+    printf("%s, n = %zu\n", label, list->length);
+
+    ListSimdLevel best = list_simd_level();
+    const char* steps[5] = { "find (miss)", "count in range", "min + max", "sum", "filter > 990" };
+    double times[4][5] = { { 0 } };
+    double checks[4][5] = { { 0 } };
+
+    // Column 0: generic functions
+    double start = now_seconds();
+    checks[0][0] = index_of(list, double_is_missing);
+    times[0][0] = now_seconds() - start;
+
+    start = now_seconds();
+    checks[0][1] = (double)count_matching(list, double_in_range);
+    times[0][1] = now_seconds() - start;
+
+    start = now_seconds();
+    checks[0][2] = *(double*)min_by(list, compare_double) + *(double*)max_by(list, compare_double);
+    times[0][2] = now_seconds() - start;
+
+    start = now_seconds();
+    ListPipeline* pipeline = pipeline_from_list(list);
+    double total = 0.0;
+    pipeline_reduce(pipeline, sum_double, &total);
+    pipeline_destroy(pipeline);
+    checks[0][3] = total;
+    times[0][3] = now_seconds() - start;
+
+    start = now_seconds();
+    LinkedList* filtered = filter(list, double_above_threshold);
+    times[0][4] = now_seconds() - start;
+    checks[0][4] = filtered ? (double)filtered->length : -1.0;
+    destroy(filtered);
+
+    // Columns 1..3: the kernels at each level this CPU supports
+    for (int level = LIST_SIMD_SCALAR; level <= (int)best; level++) {
+        list_set_simd_level((ListSimdLevel)level);
+        double* row = times[level + 1];
+        double* check = checks[level + 1];
+
+        start = now_seconds();
+        check[0] = list_find_f64(list, -1.0);
+        row[0] = now_seconds() - start;
+
+        start = now_seconds();
+        check[1] = (double)list_count_in_range_f64(list, 0.0, 100.0);
+        row[1] = now_seconds() - start;
+
+        double min = 0.0, max = 0.0;
+        start = now_seconds();
+        list_min_max_f64(list, &min, &max);
+        row[2] = now_seconds() - start;
+        check[2] = min + max;
+
+        start = now_seconds();
+        list_sum_f64(list, &check[3]);
+        row[3] = now_seconds() - start;
+
+        start = now_seconds();
+        filtered = list_filter_greater_f64(list, 990.0);
+        row[4] = now_seconds() - start;
+        check[4] = filtered ? (double)filtered->length : -1.0;
+        destroy(filtered);
+    }
+    list_set_simd_level(best);
+
+    printf("  %-15s %10s %10s %10s %10s\n", "", "generic", "scalar", "sse2", "avx2");
+    for (int i = 0; i < 5; i++) {
+        printf("  %-15s", steps[i]);
+        for (int column = 0; column < 4; column++) {
+            if (column > (int)best + 1) printf(" %10s", "n/a");
+            else printf(" %9.4fs", times[column][i]);
+        }
+        printf("\n");
+    }
+
+    // Sums may differ in the last bits (different addition order); everything else must match
+    bool same = true;
+    for (int column = 1; column <= (int)best + 1; column++) {
+        for (int i = 0; i < 5; i++) {
+            double diff = checks[column][i] - checks[0][i];
+            if (diff < 0) diff = -diff;
+            if (i == 3 ? diff > 1e-6 * (checks[0][i] < 0 ? -checks[0][i] : checks[0][i]) : diff != 0) same = false;
+        }
+    }
+    printf("  results match: %s\n", same ? "yes" : "NO");
+}
+
+int compare_record_id(const void* a, const void* b) {
+    int x = ((const Record*)a)->id;
+    int y = ((const Record*)b)->id;
+    return (x > y) - (x < y);
+}
+
+// Fills 'list' with n records with random ids (negative ones included); NULL on failure
+LinkedList* build_record_list(size_t n, LinkedList* list) {
+    if (!list) return NULL;
+    unsigned int state = 31337u;
+    for (size_t i = 0; i < n; i++) {
+        Record record = { (int)next_random(&state), (int)(i % 90), (double)i };
+        if (insert_tail_value_internal(list, &record) != LIST_SUCCESS) {
+            destroy(list);
+            return NULL;
+        }
+    }
+    return list;
+}
+
+bool is_sorted_by_id(const LinkedList* list) {
+    for (size_t i = 1; i < list->length; i++) {
+        if (compare_record_id(get(list, i - 1), get(list, i)) > 0) return false;
+    }
+    return true;
+}
+
+// sort_list (merge sort, compare function) vs. sort_list_by_key (radix sort on Record.id)
+void bench_radix(size_t n) {
+    printf("n = %zu records\n", n);
+
+    const char* labels[2] = { "nodes", "contiguous" };
+    for (int storage = 0; storage < 2; storage++) {
+        double times[2];
+        bool sorted[2];
+        for (int method = 0; method < 2; method++) {
+            LinkedList* list = build_record_list(n, storage == 0 ? create_list(sizeof(Record))
+                                                                 : create_list_contiguous(sizeof(Record)));
+            if (!list) {
+                printf("  failed to build list\n");
+                return;
+            }
+            double start = now_seconds();
+            if (method == 0) sort_list(list, compare_record_id);
+            else sort_list_by_field(list, Record, id, true);
+            times[method] = now_seconds() - start;
+            sorted[method] = is_sorted_by_id(list);
+            destroy(list);
+        }
+        printf("  %-10s  sort_list: %8.4fs   sort_list_by_key: %8.4fs   (%.1fx)%s\n", labels[storage],
+               times[0], times[1], times[1] > 0 ? times[0] / times[1] : 0.0,
+               sorted[0] && sorted[1] ? "" : "  NOT SORTED");
+    }
+}
+
+int compare_record_age(const void* a, const void* b) {
+    int x = ((const Record*)a)->age;
+    int y = ((const Record*)b)->age;
+    return (x > y) - (x < y);
+}
+
+// sort_list_parallel at 1/2/4/8/16 threads; records are sorted by age (90 values, so many ties)
+// and every result is checked against the serial stable sort
+void bench_parallel_sort(size_t n) {
+#ifdef _SC_NPROCESSORS_ONLN
+    printf("n = %zu records, %ld core(s) online\n", n, sysconf(_SC_NPROCESSORS_ONLN));
+#else
+    printf("n = %zu records\n", n);
+#endif
+
+    const char* labels[2] = { "nodes", "contiguous" };
+    const size_t thread_counts[] = { 1, 2, 4, 8, 16 };
+    for (int storage = 0; storage < 2; storage++) {
+        LinkedList* reference = build_record_list(n, storage == 0 ? create_list(sizeof(Record))
+                                                                  : create_list_contiguous(sizeof(Record)));
+        if (!reference) {
+            printf("  failed to build list\n");
+            return;
+        }
+        sort_list(reference, compare_record_age);
+        size_t expected_size;
+        Record* expected = to_array(reference, &expected_size);
+        destroy(reference);
+
+        printf("  %s\n", labels[storage]);
+        double single = 0.0;
+        for (size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++) {
+            LinkedList* list = build_record_list(n, storage == 0 ? create_list(sizeof(Record))
+                                                                 : create_list_contiguous(sizeof(Record)));
+            if (!list) break;
+
+            double start = now_seconds();
+            sort_list_parallel(list, compare_record_age, thread_counts[i]);
+            double elapsed = now_seconds() - start;
+            if (i == 0) single = elapsed;
+
+            size_t size;
+            Record* result = to_array(list, &size);
+            bool identical = expected && result && size == expected_size &&
+                             memcmp(result, expected, size * sizeof(Record)) == 0;
+            free(result);
+            destroy(list);
+
+            printf("    %2zu thread(s): %8.4fs  (%.2fx)  %s\n", thread_counts[i], elapsed,
+                   elapsed > 0 ? single / elapsed : 0.0, identical ? "identical to serial" : "DIFFERENT");
+        }
+        free(expected);
+    }
+}
+
+int compare_record_age_descending(const void* a, const void* b) {
+    return compare_record_age(b, a);
+}
+
+// Compares the first 'count' records of two lists
+bool same_records(const LinkedList* a, const LinkedList* b, size_t count) {
+    if (!a || !b || a->length < count || b->length < count) return false;
+    for (size_t i = 0; i < count; i++) {
+        if (memcmp(get(a, i), get(b, i), sizeof(Record)) != 0) return false;
+    }
+    return true;
+}
+
+// The k oldest records and the median id: full sort_list vs. top_k / partial_sort_list / nth_element
+void bench_selection(size_t n, size_t k) {
+    printf("n = %zu records, k = %zu\n", n, k);
+
+    const char* labels[2] = { "nodes", "contiguous" };
+    for (int storage = 0; storage < 2; storage++) {
+        LinkedList* original = build_record_list(n, storage == 0 ? create_list(sizeof(Record))
+                                                                 : create_list_contiguous(sizeof(Record)));
+        LinkedList* sorted = copy(original);
+        LinkedList* partial = copy(original);
+        LinkedList* selected = copy(original);
+        if (!original || !sorted || !partial || !selected) {
+            printf("  failed to build lists\n");
+            destroy(original);
+            destroy(sorted);
+            destroy(partial);
+            destroy(selected);
+            return;
+        }
+
+        // k oldest: sort everything, then slice off the front
+        double start = now_seconds();
+        sort_list(sorted, compare_record_age_descending);
+        LinkedList* sliced = slice(sorted, 0, k);
+        double full_time = now_seconds() - start;
+
+        start = now_seconds();
+        LinkedList* oldest = top_k(original, k, compare_record_age_descending);
+        double top_time = now_seconds() - start;
+
+        start = now_seconds();
+        partial_sort_list(partial, k, compare_record_age_descending);
+        double partial_time = now_seconds() - start;
+
+        bool same = same_records(sliced, oldest, k) && same_records(sliced, partial, k);
+        printf("  %-10s  %zu oldest   sort_list + slice: %8.4fs   top_k: %8.4fs (%.1fx)   "
+               "partial_sort_list: %8.4fs (%.1fx)%s\n", labels[storage], k, full_time, top_time,
+               top_time > 0 ? full_time / top_time : 0.0, partial_time,
+               partial_time > 0 ? full_time / partial_time : 0.0, same ? "" : "  DIFFERENT");
+        destroy(sliced);
+        destroy(oldest);
+
+        // Median id: sort everything vs. quickselect
+        start = now_seconds();
+        sort_list(sorted, compare_record_id);
+        int sorted_median = ((Record*)get(sorted, n / 2))->id;
+        full_time = now_seconds() - start;
+
+        start = now_seconds();
+        nth_element(selected, n / 2, compare_record_id);
+        int selected_median = ((Record*)get(selected, n / 2))->id;
+        double select_time = now_seconds() - start;
+
+        printf("  %-10s  median id   sort_list + get:   %8.4fs   nth_element: %8.4fs (%.1fx)%s\n",
+               labels[storage], full_time, select_time, select_time > 0 ? full_time / select_time : 0.0,
+               sorted_median == selected_median ? "" : "  DIFFERENT");
+
+        destroy(original);
+        destroy(sorted);
+        destroy(partial);
+        destroy(selected);
+    }
+}
+
+// Writes 'list' in the pre-v2 binary layout: [size_t length][size_t element_size][raw bytes...]
+bool write_legacy_binary(const LinkedList* list, const char* filename) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) return false;
+    size_t size;
+    void* elements = to_array(list, &size);
+    bool ok = elements && fwrite(&list->length, sizeof(size_t), 1, file) == 1 &&
+              fwrite(&list->element_size, sizeof(size_t), 1, file) == 1 &&
+              fwrite(elements, list->element_size, size, file) == size;
+    free(elements);
+    return fclose(file) == 0 && ok;
+}
+
+// Binary files: v2 save / verify / range load / mmap load / load, and loading the same data as a legacy file
+void bench_binary_files(size_t n) {
+    const char* v2_file = "bench_list_v2.bin";
+    const char* legacy_file = "bench_list_legacy.bin";
+    printf("n = %zu records (%zu MiB)\n", n, n * sizeof(Record) >> 20);
+
+    LinkedList* list = build_record_list(n, create_list_contiguous(sizeof(Record)));
+    if (!list || !write_legacy_binary(list, legacy_file)) {
+        printf("  failed to prepare files\n");
+        destroy(list);
+        return;
+    }
+
+    double start = now_seconds();
+    ListResult saved = save_to_file(list, v2_file, FILE_FORMAT_BINARY, NULL);
+    printf("  save_to_file (v2):            %8.4fs  %s\n", now_seconds() - start, error_string(saved));
+
+    start = now_seconds();
+    ListResult verified = verify_list_file(v2_file);
+    printf("  verify_list_file (v2):        %8.4fs  %s\n", now_seconds() - start, error_string(verified));
+
+    start = now_seconds();
+    LinkedList* range = load_range_from_file(v2_file, sizeof(Record), n / 2, 1000);
+    double elapsed = now_seconds() - start;
+    bool same = range && range->length == 1000 &&
+                memcmp(get(range, 0), get(list, n / 2), sizeof(Record)) == 0;
+    printf("  load_range_from_file (1000):  %8.4fs  %s\n", elapsed, same ? "ok" : "FAILED");
+    destroy(range);
+
+    start = now_seconds();
+    LinkedList* mapped = load_from_file_mmap(v2_file, sizeof(Record));
+    elapsed = now_seconds() - start;
+    same = mapped && mapped->length == n && same_records(mapped, list, 1000);
+    printf("  load_from_file_mmap (v2):     %8.4fs  %s\n", elapsed, same ? "ok" : "FAILED");
+    destroy(mapped);
+
+    const char* files[2] = { legacy_file, v2_file };
+    const char* labels[2] = { "legacy", "v2" };
+    for (int i = 0; i < 2; i++) {
+        start = now_seconds();
+        LinkedList* loaded = load_from_file(files[i], sizeof(Record), FILE_FORMAT_BINARY, NULL, NULL, NULL, NULL, NULL);
+        elapsed = now_seconds() - start;
+        same = loaded && loaded->length == n && same_records(loaded, list, 1000);
+        printf("  load_from_file (%-6s):      %8.4fs  %s\n", labels[i], elapsed, same ? "ok" : "FAILED");
+        destroy(loaded);
+    }
+
+    destroy(list);
+    remove(v2_file);
+    remove(legacy_file);
+}
+
+// The text save_to_file shipped before the buffered writer (one fprintf per element, or per
+// byte for hex dumps), newline separated. Kept here only for comparison.
+ListResult save_text_reference(const LinkedList* list, const char* filename) {
+    FILE* file = fopen(filename, "w");
+    if (!file) return LIST_ERROR_INVALID_OPERATION;
+    for (size_t i = 0; i < list->length; i++) {
+        void* element = get(list, i);
+        if (list->element_size == sizeof(int)) {
+            fprintf(file, "%d", *(int*)element);
+        } else if (list->element_size == sizeof(double)) {
+            fprintf(file, "%.*g", 15, *(double*)element);
+        } else {
+            unsigned char* bytes = (unsigned char*)element;
+            for (size_t j = 0; j < list->element_size; ++j) {
+                fprintf(file, "%02X", bytes[j]);
+                if (j + 1 < list->element_size) fputc(' ', file);
+            }
+        }
+        if (i + 1 < list->length) fputc('\n', file);
+    }
+    fclose(file);
+    return LIST_SUCCESS;
+}
+
+bool same_file_contents(const char* first, const char* second) {
+    FILE* a = fopen(first, "rb");
+    FILE* b = fopen(second, "rb");
+    bool same = a && b;
+    while (same) {
+        int x = fgetc(a);
+        int y = fgetc(b);
+        if (x != y) same = false;
+        if (x == EOF) break;
+    }
+    if (a) fclose(a);
+    if (b) fclose(b);
+    return same;
+}
+
+// Text save_to_file: buffered writer vs. the old fprintf-per-element writer (contiguous lists,
+// so the walk itself costs next to nothing)
+void bench_text_save(size_t n) {
+    const char* new_file = "bench_save_new.txt";
+    const char* old_file = "bench_save_old.txt";
+    printf("n = %zu elements\n", n);
+
+    LinkedList* ints = create_list_contiguous(sizeof(int));
+    LinkedList* whole = create_list_contiguous(sizeof(double));
+    LinkedList* fractions = create_list_contiguous(sizeof(double));
+    LinkedList* records = build_record_list(n / 10, create_list_contiguous(sizeof(Record)));
+    unsigned int state = 4242u;
+    for (size_t i = 0; ints && whole && fractions && i < n; i++) {
+        int value = (int)next_random(&state);
+        double whole_value = (double)(value / 7);
+        double fraction = value / 1000.0;
+        insert_tail_value_internal(ints, &value);
+        insert_tail_value_internal(whole, &whole_value);
+        insert_tail_value_internal(fractions, &fraction);
+    }
+
+    LinkedList* lists[4] = { ints, whole, fractions, records };
+    const char* labels[4] = { "int", "double (whole)", "double", "Record (hex)" };
+    for (int i = 0; i < 4; i++) {
+        if (!lists[i]) continue;
+        double start = now_seconds();
+        save_text_reference(lists[i], old_file);
+        double old_time = now_seconds() - start;
+
+        start = now_seconds();
+        save_to_file(lists[i], new_file, FILE_FORMAT_TEXT, "\n");
+        double new_time = now_seconds() - start;
+
+        printf("  %-15s %9zu elements   fprintf: %8.4fs   buffered: %8.4fs   (%.1fx)%s\n", labels[i],
+               lists[i]->length, old_time, new_time, new_time > 0 ? old_time / new_time : 0.0,
+               same_file_contents(old_file, new_file) ? "" : "  DIFFERENT OUTPUT");
+        destroy(lists[i]);
+    }
+
+    remove(new_file);
+    remove(old_file);
+}
+
+// The whitespace-mode text load_from_file shipped before the buffered tokenizer (fscanf per
+// number, fgets/strtok/sscanf per hex dump line). Kept here only for comparison.
+LinkedList* load_text_reference(const char* filename, size_t element_size) {
+    FILE* file = fopen(filename, "r");
+    LinkedList* list = file ? create_list(element_size) : NULL;
+    if (!list) {
+        if (file) fclose(file);
+        return NULL;
+    }
+    if (element_size == sizeof(int)) {
+        int value;
+        while (fscanf(file, "%d", &value) == 1) insert_tail_value_internal(list, &value);
+    } else if (element_size == sizeof(double)) {
+        double value;
+        while (fscanf(file, "%lf", &value) == 1) insert_tail_value_internal(list, &value);
+    } else {
+        unsigned char* buffer = malloc(element_size);
+        char line[4096];
+        while (buffer && fgets(line, sizeof(line), file)) {
+            size_t count = 0;
+            char* token = strtok(line, " \t\r\n");
+            while (token && count < element_size) {
+                unsigned int byte;
+                if (sscanf(token, "%02X", &byte) != 1) break;
+                buffer[count++] = (unsigned char)byte;
+                token = strtok(NULL, " \t\r\n");
+            }
+            if (count == element_size) insert_tail_value_internal(list, buffer);
+        }
+        free(buffer);
+    }
+    fclose(file);
+    return list;
+}
+
+bool same_elements(LinkedList* a, LinkedList* b) {
+    if (!a || !b || a->length != b->length || a->element_size != b->element_size) return false;
+    ListCursor x = cursor_begin(a);
+    ListCursor y = cursor_begin(b);
+    for (; cursor_valid(&x); cursor_next(&x), cursor_next(&y)) {
+        if (memcmp(cursor_peek(&x), cursor_peek(&y), a->element_size) != 0) return false;
+    }
+    return true;
+}
+
+// Whitespace-mode text load_from_file: buffered tokenizer vs. the old fscanf loader
+void bench_text_load(size_t n) {
+    const char* file = "bench_load.txt";
+    printf("n = %zu elements\n", n);
+
+    LinkedList* ints = create_list_contiguous(sizeof(int));
+    LinkedList* fractions = create_list_contiguous(sizeof(double));
+    LinkedList* records = build_record_list(n / 10, create_list_contiguous(sizeof(Record)));
+    unsigned int state = 4242u;
+    for (size_t i = 0; ints && fractions && i < n; i++) {
+        int value = (int)next_random(&state);
+        double fraction = value / 1000.0;
+        insert_tail_value_internal(ints, &value);
+        insert_tail_value_internal(fractions, &fraction);
+    }
+
+    LinkedList* lists[3] = { ints, fractions, records };
+    const char* labels[3] = { "int", "double", "Record (hex)" };
+    for (int i = 0; i < 3; i++) {
+        if (!lists[i]) continue;
+        size_t size = lists[i]->element_size;
+        save_to_file(lists[i], file, FILE_FORMAT_TEXT, "\n");
+        destroy(lists[i]);
+
+        double start = now_seconds();
+        LinkedList* old_list = load_text_reference(file, size);
+        double old_time = now_seconds() - start;
+
+        start = now_seconds();
+        LinkedList* new_list = load_from_file(file, size, FILE_FORMAT_TEXT, NULL, NULL, NULL, NULL, NULL);
+        double new_time = now_seconds() - start;
+
+        printf("  %-15s %9zu elements   fscanf: %8.4fs   tokenizer: %8.4fs   (%.1fx)%s\n", labels[i],
+               new_list ? new_list->length : 0, old_time, new_time, new_time > 0 ? old_time / new_time : 0.0,
+               same_elements(old_list, new_list) ? "" : "  DIFFERENT ELEMENTS");
+        destroy(old_list);
+        destroy(new_list);
+    }
+
+    remove(file);
+}
+
+// The custom-separator load_from_file shipped before the streaming splitter: the whole file is
+// read into memory and split with strstr, one sscanf per field (ints and doubles only). Kept here
+// only for comparison; 'peak_bytes' gets the size of its file copy.
+LinkedList* load_separated_reference(const char* filename, size_t element_size, const char* separator,
+                                     size_t* peak_bytes) {
+    FILE* file = fopen(filename, "r");
+    if (!file) return NULL;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char* content = size >= 0 ? malloc((size_t)size + 1) : NULL;
+    LinkedList* list = content ? create_list(element_size) : NULL;
+    if (!list) {
+        free(content);
+        fclose(file);
+        return NULL;
+    }
+    content[fread(content, 1, (size_t)size, file)] = '\0';
+    *peak_bytes = (size_t)size + 1;
+
+    size_t separator_length = strlen(separator);
+    char* start = content;
+    for (;;) {
+        char* end = strstr(start, separator);
+        if (end) *end = '\0';
+        if (element_size == sizeof(int)) {
+            int value;
+            if (sscanf(start, "%d", &value) == 1) insert_tail_value_internal(list, &value);
+        } else {
+            double value;
+            if (sscanf(start, "%lf", &value) == 1) insert_tail_value_internal(list, &value);
+        }
+        if (!end) break;
+        start = end + separator_length;
+    }
+    free(content);
+    fclose(file);
+    return list;
+}
+
+// Custom-separator load_from_file: streaming splitter vs. the old whole-file strstr loader
+void bench_separated_load(size_t n) {
+    const char* file = "bench_load.csv";
+    printf("n = %zu elements, separator \",\"\n", n);
+
+    LinkedList* ints = create_list_contiguous(sizeof(int));
+    LinkedList* fractions = create_list_contiguous(sizeof(double));
+    unsigned int state = 4242u;
+    for (size_t i = 0; ints && fractions && i < n; i++) {
+        int value = (int)next_random(&state);
+        double fraction = value / 1000.0;
+        insert_tail_value_internal(ints, &value);
+        insert_tail_value_internal(fractions, &fraction);
+    }
+
+    LinkedList* lists[2] = { ints, fractions };
+    const char* labels[2] = { "int", "double" };
+    for (int i = 0; i < 2; i++) {
+        if (!lists[i]) continue;
+        size_t size = lists[i]->element_size;
+        save_to_file(lists[i], file, FILE_FORMAT_TEXT, ",");
+        destroy(lists[i]);
+
+        size_t old_bytes = 0;
+        double start = now_seconds();
+        LinkedList* old_list = load_separated_reference(file, size, ",", &old_bytes);
+        double old_time = now_seconds() - start;
+
+        start = now_seconds();
+        LinkedList* new_list = load_from_file(file, size, FILE_FORMAT_TEXT, ",", NULL, NULL, NULL, NULL);
+        double new_time = now_seconds() - start;
+
+        printf("  %-7s whole file (%5.1f MiB): %8.4fs   streaming (1 MiB buffer): %8.4fs   (%.1fx)%s\n",
+               labels[i], old_bytes / (1024.0 * 1024.0), old_time, new_time,
+               new_time > 0 ? old_time / new_time : 0.0,
+               same_elements(old_list, new_list) ? "" : "  DIFFERENT ELEMENTS");
+        destroy(old_list);
+        destroy(new_list);
+    }
+
+    remove(file);
+}
+
+int main(int argc, char** argv) {
+
+    if (argc > 1 && strcmp(argv[1], "full") == 0) {
+        bubble_sort_limit = BUBBLE_SORT_FULL_LIMIT;
+    }
+
+    printf("Generic Linked List Library - Benchmarks\n");
+    printf("========================================\n");
+
+    banner("sort_list: merge sort vs. old bubble sort");
+    const size_t sort_sizes[] = { 1000, 100000, 10000000 };
+    for (size_t i = 0; i < sizeof(sort_sizes) / sizeof(sort_sizes[0]); i++) {
+        bench_sort(sort_sizes[i]);
+    }
+
+    banner("sort by integer key: merge sort vs. radix sort");
+    bench_radix(10000000);
+
+    banner("parallel merge sort: scaling with threads");
+    bench_parallel_sort(2000000);
+
+    banner("selection: top_k / partial_sort_list / nth_element vs. full sort");
+    bench_selection(5000000, 100);
+
+    banner("binary files: v2 format (checksummed blocks) vs. legacy");
+    bench_binary_files(10000000);
+
+    banner("text save_to_file: buffered writer vs. fprintf");
+    bench_text_save(10000000);
+
+    banner("text load_from_file: buffered tokenizer vs. fscanf");
+    bench_text_load(5000000);
+
+    banner("custom-separator load_from_file: streaming vs. whole file");
+    bench_separated_load(5000000);
+
+    banner("insert/delete churn: malloc vs. node pool");
+    bench_churn(10000000);
+
+    banner("destroy: per-node free vs. bulk pool release");
+    bench_teardown(20000000);
+
+    banner("sequential get() loop");
+    bench_sequential_get(1000000);
+
+    banner("random positional access: walk vs. skip-list index");
+    bench_random_access(200000, 10000);
+
+    banner("unique: nested scan vs. hash set");
+    bench_unique(20000);
+    bench_unique(500000);
+
+    banner("filter/map/count: eager lists vs. lazy pipeline");
+    bench_pipeline(5000000);
+
+    banner("storage modes: nodes vs. contiguous vs. unrolled");
+    bench_storage(5000000, 1000000, 2000);
+
+    banner("generic void* list vs. typed list (linked_list_typed.h)");
+    bench_typed(1000000, 100);
+
+    banner("numeric kernels on double lists: generic vs. scalar / SSE2 / AVX2");
+    LinkedList* samples[2] = { create_list_contiguous(sizeof(double)), create_list_unrolled(sizeof(double), 0) };
+    const char* sample_labels[2] = { "contiguous", "unrolled" };
+    for (int i = 0; i < 2; i++) {
+        unsigned int state = 4242u;
+        for (size_t k = 0; k < 10000000 && samples[i]; k++) {
+            double value = (double)(next_random(&state) % 100000) / 100.0;  // 0.00 .. 999.99
+            insert_tail_value_internal(samples[i], &value);
+        }
+        if (samples[i]) bench_numeric(samples[i], sample_labels[i]);
+        destroy(samples[i]);
+    }
+
+    printf("\n✓ Benchmarks completed\n");
+    return 0;
+}
@@ -8,18 +8,90 @@
  * declared in linked_list.h. It handles memory management and list manipulation.
  */
 
+// POSIX declarations (mmap, fstat...) for load_from_file_mmap(); must come before any system header
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "linked_list.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+
+// Memory-mapped loading (section 11); elsewhere load_from_file_mmap() reads the file instead
+#if defined(__unix__) || defined(__APPLE__)
+#define LIST_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// x86 SIMD kernels for the numeric functions (section 9B); other targets use the portable loops
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define LIST_SIMD_X86
+#include <immintrin.h>
+#endif
 
 
 // Function only for internal use
-static ListResult handle_size_limit(LinkedList*);
-static ListResult delete_node_core(LinkedList*, Node*);          // Core deletion helper
+static ListResult trim_to_max_size(LinkedList*);
+static ListResult delete_node_core(LinkedList*, Node*, size_t);  // Core deletion helper
+static Node* find_node_by_index(const LinkedList*, size_t, LinkedList*); // Index lookup (head, tail or finger)
+static bool finger_read(const LinkedList*, Node**, size_t*);           // Consistent copy of the finger
+static void finger_move(const LinkedList*, Node*, size_t, bool);       // Best-effort update (safe for readers)
 static void copy_list_configuration(LinkedList*, const LinkedList*); // Helper to copy function pointers
-
-// Forward declarations for functions used in handle_size_limit
+static Node* allocate_node(LinkedList*, ListMemoryMode);            // Node memory (pool or malloc)
+static void release_node(LinkedList*, Node*);                       // Returns node memory (pool or free)
+static void pool_destroy(struct NodePool*);                         // Frees every pool chunk
+static void pool_reset(struct NodePool*);                           // Drops every node at once
+static void release_file_mapping(LinkedList*);                      // Unmaps a load_from_file_mmap() file
+static bool pool_reserve(struct NodePool*, size_t);                 // Preallocates node slots
+
+// Position bookkeeping shared by every structural change (see section 6)
+#define LIST_INDEX_UNKNOWN ((size_t)-1)
+static void note_node_inserted(LinkedList*, Node*, size_t);       // A node now sits at index
+static void note_node_removed(LinkedList*, Node*, size_t);        // A node left index (or unknown)
+static void note_order_changed(LinkedList*);                      // Any larger rearrangement
+static void note_list_rearranged(LinkedList*);                    // O(n) rearrangement (rebuilds the index)
+
+// Positional index (see section 6D)
+struct SkipIndex;
+static void skip_note_inserted(LinkedList*, Node*, size_t);       // Adds or widens express links
+static void skip_note_removed(LinkedList*, Node*, size_t);        // Removes or narrows express links
+static void skip_invalidate(struct SkipIndex*);                    // Drops every tower (rebuilt lazily)
+static void skip_refresh(LinkedList*);                              // Rebuilds a dirty index (O(n))
+static Node* skip_lookup(const LinkedList*, size_t);                // Node at index (NULL = unavailable)
+static void skip_index_destroy(struct SkipIndex*);                  // Frees the whole index
+#define SKIP_WALK_LIMIT 32  // Plain walks up to this many steps beat descending the index
+
+// Element walks (see section 2C): one traversal for every storage mode, a whole list or a view
+typedef struct {
+    ListStorage storage;
+    // Node and unrolled storage
+    Node* node;              // Next node (or block) to visit
+    Node* stop;              // Node where the walk ends (not visited)
+    bool backward;
+    Node* visited;           // Node storage: node of the element walk_next() returned last
+    // Contiguous storage and the current unrolled block
+    unsigned char* element;  // Next element to visit
+    size_t remaining;        // Elements left to visit
+    ptrdiff_t step;          // Bytes between consecutive elements (negative going backward)
+} ElementWalk;
+static void walk_list(ElementWalk*, const LinkedList*, Direction);  // Every element of a list
+static void walk_nodes(ElementWalk*, Node*, Node*);                  // Nodes first .. end (end excluded)
+#define UNROLLED_DEFAULT_BLOCK_BYTES 256  // Default block payload of create_list_unrolled()
+
+// Walk helpers shared by whole-list functions and ListViews
+static void* extreme_in_walk(ElementWalk*, CompareFunction, int);   // min_by (-1) / max_by (+1)
+static void* walk_to_array(ElementWalk*, size_t, size_t);           // to_array of 'count' elements
+
+// Forward declarations for functions used in trim_to_max_size
 ListResult delete_head(LinkedList* list);
 
 /*
@@ -48,6 +120,8 @@ const char* error_string(ListResult result) {
         case LIST_ERROR_NO_COMPARE_FUNCTION: return "Compare function required but not provided";
         case LIST_ERROR_NO_PRINT_FUNCTION: return "Print function required but not provided";
         case LIST_ERROR_NO_FREE_FUNCTION: return "Free function required but not provided";
+        case LIST_ERROR_IO: return "File could not be read or written";
+        case LIST_ERROR_CORRUPT_DATA: return "File is damaged or not a list file";
         default: return "Unknown error";
     }
 }
@@ -103,9 +177,83 @@ LinkedList* create_list(size_t element_size) {
     list->free_node_function = NULL;       
     list->copy_node_function = NULL;       
 
+    // Nodes come from malloc until list_enable_pool() is called
+    list->pool = NULL;
+    list->pointer_nodes = 0;
+    list->mapping = NULL;
+
+    // No index lookup has happened yet
+    list->finger_node = NULL;
+    list->finger_index = 0;
+    list->finger_seq = 0;
+    list->finger_lookups = 0;
+    list->finger_hits = 0;
+
+    // Indexed mode is opt-in (list_enable_index())
+    list->skip_index = NULL;
+
+    list->version = 0;
+
+    // One node per element unless created with create_list_contiguous()
+    list->storage = LIST_STORAGE_NODES;
+    list->elements = NULL;
+    list->capacity = 0;
+    list->first_slot = 0;
+    list->block_capacity = 0;
+
+    return list;
+}
+
+/**
+ * @brief Creates a list that keeps its elements in one contiguous, growable array ("vector mode").
+ * @param element_size The size of each element in bytes.
+ * @return A pointer to the newly created LinkedList, or NULL on failure.
+ * @note Works with the same functions as any other list; get() is O(1), to_array() a single copy
+ *       and scans run at array speed. Inserting or deleting in the middle moves the elements
+ *       after it. Node-only features (pools, index, cursors, views, splicing) are not available.
+ */
+LinkedList* create_list_contiguous(size_t element_size) {
+
+    if (element_size == 0) return NULL;
+
+    LinkedList* list = create_list(element_size);
+    if (!list) return NULL;
+
+    list->storage = LIST_STORAGE_CONTIGUOUS;
+    return list;
+}
+
+/**
+ * @brief Creates a list that stores its elements in linked blocks of several elements each ("unrolled list").
+ * @param element_size The size of each element in bytes.
+ * @param block_bytes Element bytes per block (0 = 256, a few cache lines); each block holds at least one element.
+ * @return A pointer to the newly created LinkedList, or NULL on failure.
+ * @note A middle ground between create_list() and create_list_contiguous(): scans read the elements
+ *       of a block back to back, and inserting or deleting anywhere only moves elements inside one
+ *       block. Node-only features (pools, index, cursors, views, splicing) are not available.
+ */
+LinkedList* create_list_unrolled(size_t element_size, size_t block_bytes) {
+
+    if (element_size == 0) return NULL;
+
+    LinkedList* list = create_list(element_size);
+    if (!list) return NULL;
+
+    if (block_bytes == 0) block_bytes = UNROLLED_DEFAULT_BLOCK_BYTES;
+    list->storage = LIST_STORAGE_UNROLLED;
+    list->block_capacity = block_bytes / element_size ? block_bytes / element_size : 1;
     return list;
 }
 
+// INTERNAL HELPER FUNCTION creating an empty list with the same storage as 'model' (for copy, filter...)
+static LinkedList* create_list_like(const LinkedList* model, size_t element_size) {
+    switch (model->storage) {
+        case LIST_STORAGE_CONTIGUOUS: return create_list_contiguous(element_size);
+        case LIST_STORAGE_UNROLLED: return create_list_unrolled(element_size, model->block_capacity * model->element_size);
+        default: return create_list(element_size);
+    }
+}
+
 /**
  * @brief Sets the struct name for the list.
  * @param list The list to configure.
@@ -182,6 +330,7 @@ void set_copy_function(LinkedList* list, CopyFunction copy_fn) {
  * @brief Sets the maximum size of the list and overflow behavior.
  * @param list The list to configure.
  * @param max_size Maximum number of elements (UNLIMITED = no limit).
+ * @param behavior What an insertion into a full list does (reject it or evict the oldest element).
  */
 ListResult set_max_size(LinkedList* list, size_t max_size, OverflowBehavior behavior) {
     
@@ -192,26 +341,25 @@ ListResult set_max_size(LinkedList* list, size_t max_size, OverflowBehavior beha
     list->allow_overwrite = behavior;
 
     // Check if we need to remove excess elements due to new size limit
-    return handle_size_limit(list);
+    return trim_to_max_size(list);
 }
 
-// INTERNAL HELPER FUNCTION for handling size limits
-static ListResult handle_size_limit(LinkedList* list) {
+// INTERNAL HELPER FUNCTION for bringing an over-long list back within max_size
+static ListResult trim_to_max_size(LinkedList* list) {
     if (!list) return LIST_ERROR_NULL_POINTER;
     
     // If unlimited size or current length is within limits - no action needed
-    if (list->max_size == UNLIMITED || list->length < list->max_size) {
+    if (list->max_size == UNLIMITED || list->length <= list->max_size) {
         return LIST_SUCCESS;
     }
 
-    // If we reach this point, the list is full, but overwrite is not allowed
+    // If we reach this point, the list is over the limit, but deleting is not allowed
     if (list->allow_overwrite == REJECT_NEW_WHEN_FULL) {
         return LIST_ERROR_LIST_FULL;
     }
 
-    // Handle any case where we need to remove elements to stay within limit
-    while (list->length >= list->max_size) {
-        // Remove oldest element (from head) to make room for FIFO behavior
+    // Remove oldest elements (from head) until the limit is respected
+    while (list->length > list->max_size) {
         ListResult result = delete_head(list);
         if (result != LIST_SUCCESS) {
             return result;
@@ -221,1525 +369,6827 @@ static ListResult handle_size_limit(LinkedList* list) {
     return LIST_SUCCESS;
 }
 
+/**
+ * @brief Turns the list into a fixed-capacity ring buffer (a sliding window of the newest elements).
+ * @param list The list to configure.
+ * @param capacity Number of elements to keep (must be > 0).
+ * @return LIST_SUCCESS on success, error code on failure.
+ *
+ * Same as set_max_size(list, capacity, DELETE_OLD_WHEN_FULL), and additionally, when the list is
+ * empty, gives it a node pool with all 'capacity' slots allocated up front. Once the list is full,
+ * every insertion reuses the evicted oldest node in place, so it performs no allocation.
+ */
+ListResult set_ring_buffer(LinkedList* list, size_t capacity) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (capacity == UNLIMITED) return LIST_ERROR_INVALID_OPERATION;
+
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        // Twice the capacity lets the window slide a long way before the elements are moved back
+        // (just the capacity when doubling it would overflow)
+        ListResult result = list_reserve(list, capacity <= SIZE_MAX / 2 ? capacity * 2 : capacity);
+        if (result != LIST_SUCCESS) return result;
+    } else if (list->storage == LIST_STORAGE_NODES && is_empty(list)) {
+        if (!list->pool) {
+            ListResult result = list_enable_pool(list, capacity);
+            if (result != LIST_SUCCESS) return result;
+        }
+        if (!pool_reserve(list->pool, capacity)) return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    return set_max_size(list, capacity, DELETE_OLD_WHEN_FULL);
+}
+
 /*
 ┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
 ┃                                               ┃
-┃         3. Insertion in Linked List           ┃
+┃               2B. Node Pool                   ┃
 ┃                                               ┃
 ┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
  */
 
-// INTERNAL HELPER FUNCTION for creating a new node (unified for both modes)
-static Node* create_node_generic(LinkedList* list, void* data, ListMemoryMode mode) {
-    
-    // Create a new node
-    Node* new_node = (Node*)malloc(sizeof(Node));
-    if (!new_node) return NULL;
+// Size of a pool chunk when list_enable_pool() is called with nodes_per_chunk == 0
+#define LIST_POOL_DEFAULT_CHUNK_BYTES (64 * 1024)
+
+// One large block of equally sized node slots
+typedef struct PoolChunk {
+    struct PoolChunk* next;  // Next (older) chunk
+    size_t capacity;         // Number of node slots in this chunk
+    _Alignas(max_align_t) unsigned char slots[];
+} PoolChunk;
+
+// Per-list slab allocator: nodes are carved from chunks and recycled through a free list
+struct NodePool {
+    size_t node_size;        // Slot size: node header + element, rounded up for alignment
+    size_t nodes_per_chunk;  // Slots per newly allocated chunk
+    PoolChunk* chunks;       // All chunks, newest first
+    unsigned char* bump;     // Next never-used slot in the newest chunk
+    unsigned char* bump_end; // End of the newest chunk
+    Node* free_list;         // Recycled nodes, linked through 'next'
+    size_t chunk_count;      // Number of chunks currently held
+    size_t live_nodes;       // Nodes handed out and not yet returned
+    size_t free_list_length; // Nodes waiting on the free list
+};
+
+// INTERNAL HELPER FUNCTION for creating an empty pool
+static struct NodePool* pool_create(size_t element_size, size_t nodes_per_chunk) {
+
+    struct NodePool* pool = (struct NodePool*)calloc(1, sizeof(struct NodePool));
+    if (!pool) return NULL;
+
+    // Every slot is big enough for a value-mode node, so any node can live in any slot
+    size_t align = _Alignof(max_align_t);
+    pool->node_size = (sizeof(Node) + element_size + align - 1) / align * align;
+
+    if (nodes_per_chunk == 0) {
+        nodes_per_chunk = LIST_POOL_DEFAULT_CHUNK_BYTES / pool->node_size;
+        if (nodes_per_chunk < 16) nodes_per_chunk = 16;
+    }
+    pool->nodes_per_chunk = nodes_per_chunk;
 
-    if (mode == LIST_MODE_VALUE) {
-        // Value mode: Allocate memory and copy data
-        new_node->data = malloc(list->element_size);
-        if (!new_node->data) {
-            free(new_node);
+    return pool;
+}
+
+// INTERNAL HELPER FUNCTION for adding a chunk of 'capacity' slots; it becomes the bump chunk
+static bool pool_add_chunk(struct NodePool* pool, size_t capacity) {
+
+    PoolChunk* chunk = (PoolChunk*)malloc(sizeof(PoolChunk) + capacity * pool->node_size);
+    if (!chunk) return false;
+
+    chunk->capacity = capacity;
+    chunk->next = pool->chunks;
+    pool->chunks = chunk;
+    pool->chunk_count++;
+
+    pool->bump = chunk->slots;
+    pool->bump_end = chunk->slots + capacity * pool->node_size;
+    return true;
+}
+
+// INTERNAL HELPER FUNCTION for taking one node slot from the pool
+static Node* pool_take(struct NodePool* pool) {
+
+    Node* node;
+
+    if (pool->free_list) {
+        // Reuse a recycled node first (it is likely still in cache)
+        node = pool->free_list;
+        pool->free_list = node->next;
+        pool->free_list_length--;
+    } else {
+        if (pool->bump == pool->bump_end && !pool_add_chunk(pool, pool->nodes_per_chunk)) {
             return NULL;
         }
-        
-        // Copy the data
-        memcpy(new_node->data, data, list->element_size);
-
-    } else if (mode == LIST_MODE_POINTER) {
-        // Pointer mode: store pointer directly (ownership of the pointed block transfers to list)
-        new_node->data = data;
+        node = (Node*)pool->bump;
+        pool->bump += pool->node_size;
     }
-    
-    // Initialize pointers & mode
-    new_node->next = NULL;
-    new_node->prev = NULL;
-    new_node->mode = mode;
-    
-    return new_node;
+
+    pool->live_nodes++;
+    return node;
 }
 
-// INTERNAL CORE HELPER FUNCTION for insertion logic (unified for both modes)
-static ListResult insert_node_core_generic(LinkedList* list, void* data, ListMemoryMode mode, Node** out_new_node) {
-    
-    // Input validation
-    if (!list || !data) return LIST_ERROR_NULL_POINTER;
+// INTERNAL HELPER FUNCTION for making sure 'count' slots are available without further allocation
+static bool pool_reserve(struct NodePool* pool, size_t count) {
 
-    // Create new node using generic function
-    Node* new_node = create_node_generic(list, data, mode);
-    if (!new_node) return LIST_ERROR_MEMORY_ALLOC;
-    
-    *out_new_node = new_node;
-    return LIST_SUCCESS;
-}
+    size_t available = pool->free_list_length + (size_t)(pool->bump_end - pool->bump) / pool->node_size;
+    if (available >= count) return true;
 
-/**
- * @brief Inserts a new element at the head of the list (value mode - copies data).
- * @param list The list to insert into.
- * @param data A pointer to the data to be copied into the list.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult insert_head_value_internal(LinkedList* list, void* data) {
-    
-    Node* new_node;
-    ListResult result = insert_node_core_generic(list, data, LIST_MODE_VALUE, &new_node);
-    if (result != LIST_SUCCESS) return result;
+    // A new chunk replaces the bump chunk, so move its unused slots to the free list first
+    while (pool->bump != pool->bump_end) {
+        Node* node = (Node*)pool->bump;
+        node->next = pool->free_list;
+        pool->free_list = node;
+        pool->free_list_length++;
+        pool->bump += pool->node_size;
+    }
 
-    // Link the new node at the head
-    Node* old_first = list->head->next;
-    list->head->next = new_node;
-    new_node->prev = list->head;
-    new_node->next = old_first;
-    old_first->prev = new_node;
-    
-    list->length++;
-    return LIST_SUCCESS;
+    return pool_add_chunk(pool, count - available);
 }
 
-/**
- * @brief Inserts a new element at the tail of the list (value mode - copies data).
- * @param list The list to insert into.
- * @param data A pointer to the data to be copied into the list.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult insert_tail_value_internal(LinkedList* list, void* data) {
-    
-    Node* new_node;
-    ListResult result = insert_node_core_generic(list, data, LIST_MODE_VALUE, &new_node);
-    if (result != LIST_SUCCESS) return result;
+// INTERNAL HELPER FUNCTION for returning a node slot to the pool
+static void pool_give(struct NodePool* pool, Node* node) {
 
-    // Link the new node at the tail
-    Node* old_last = list->tail->prev;
-    list->tail->prev = new_node;
-    new_node->next = list->tail;
-    new_node->prev = old_last;
-    old_last->next = new_node;
-    
-    list->length++;
-    return LIST_SUCCESS;
+    node->next = pool->free_list;
+    pool->free_list = node;
+    pool->free_list_length++;
+    pool->live_nodes--;
 }
 
-/**
- * @brief Inserts an element at a specific index (value mode - copies data).
- * @param list The list to insert into.
- * @param index The index to insert at (0-based).
- * @param data The data to copy into the list.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult insert_index_value_internal(LinkedList* list, size_t index, void* data) {
+// INTERNAL HELPER FUNCTION for releasing every chunk and the pool itself
+static void pool_destroy(struct NodePool* pool) {
 
-    // Handle boundary conditions
-    if (index == 0) {
-        // Insert at head for index 0
-        return insert_head_value_internal(list, data);
+    if (!pool) return;
+
+    PoolChunk* chunk = pool->chunks;
+    while (chunk) {
+        PoolChunk* next_chunk = chunk->next;
+        free(chunk);
+        chunk = next_chunk;
     }
-    if (index >= list->length) {
-        // Insert at tail for indices beyond list length
-        return insert_tail_value_internal(list, data);
+    free(pool);
+}
+
+// INTERNAL HELPER FUNCTION for returning every node at once (no per-node work).
+// The newest chunk is kept for the next insertions; older chunks go back to the system.
+static void pool_reset(struct NodePool* pool) {
+
+    if (!pool->chunks) return;
+
+    PoolChunk* keep = pool->chunks;
+    PoolChunk* chunk = keep->next;
+    while (chunk) {
+        PoolChunk* next_chunk = chunk->next;
+        free(chunk);
+        chunk = next_chunk;
     }
 
-    Node* new_node;
-    ListResult result = insert_node_core_generic(list, data, LIST_MODE_VALUE, &new_node);
-    if (result != LIST_SUCCESS) return result;
-    
-    Node* current;
+    keep->next = NULL;
+    pool->chunks = keep;
+    pool->chunk_count = 1;
+    pool->bump = keep->slots;
+    pool->bump_end = keep->slots + keep->capacity * pool->node_size;
+    pool->free_list = NULL;
+    pool->free_list_length = 0;
+    pool->live_nodes = 0;
+}
 
-    // Choose direction based on which half the index is in
-    if (index <= list->length / 2) {
-        // Index is in first half - traverse forward from head
-        current = list->head->next;
-        for (size_t i = 0; i < index; i++) {
-            current = current->next;
-        }
+// INTERNAL HELPER FUNCTION for allocating node memory (from the pool when one is enabled)
+static Node* allocate_node(LinkedList* list, ListMemoryMode mode) {
+
+    if (list->pool) return pool_take(list->pool);
+
+    size_t size = (mode == LIST_MODE_VALUE) ? sizeof(Node) + list->element_size : sizeof(Node);
+    return (Node*)malloc(size);
+}
+
+// INTERNAL HELPER FUNCTION for releasing node memory (back to the pool when one is enabled).
+// Borrowed nodes live in their file mapping's node array and go away with it.
+static void release_node(LinkedList* list, Node* node) {
+
+    if (node->mode == LIST_MODE_BORROWED) return;
+
+    if (list->pool) {
+        pool_give(list->pool, node);
     } else {
-        // Index is in second half - traverse backward from tail
-        current = list->tail->prev;
-        for (size_t i = list->length - 1; i > index; i--) {
-            current = current->prev;
+        free(node);
+    }
+}
+
+// INTERNAL HELPER FUNCTION ordering chunk pointers by address (for bsearch in list_shrink_pool)
+static int compare_chunk_address(const void* a, const void* b) {
+    uintptr_t x = (uintptr_t)*(PoolChunk* const*)a;
+    uintptr_t y = (uintptr_t)*(PoolChunk* const*)b;
+    return (x > y) - (x < y);
+}
+
+// INTERNAL HELPER FUNCTION for finding the chunk that owns a node (chunks sorted by address)
+static size_t find_owning_chunk(PoolChunk** sorted, size_t count, size_t node_size, const Node* node) {
+
+    size_t low = 0, high = count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const unsigned char* start = sorted[mid]->slots;
+        if ((const unsigned char*)node < start) {
+            high = mid;
+        } else if ((const unsigned char*)node >= start + sorted[mid]->capacity * node_size) {
+            low = mid + 1;
+        } else {
+            return mid;
         }
     }
-    
-    // Insert before current
-    new_node->next = current;
-    new_node->prev = current->prev;
-    current->prev->next = new_node;
-    current->prev = new_node;
-    
-    list->length++;
-    return LIST_SUCCESS;
+    return count; // Not reached for nodes that came from this pool
 }
 
 /**
- * @brief Inserts a new element at the head of the list (pointer mode - copies pointed data).
- * @param list The list to insert into.
- * @param data_ptr A pointer to data to be copied into the list.
+ * @brief Makes the list allocate its nodes from a private slab pool.
+ * @param list The list to configure. Must be empty.
+ * @param nodes_per_chunk Node slots per chunk (0 = about 64 KiB per chunk).
  * @return LIST_SUCCESS on success, error code on failure.
+ * @note Deleted nodes are recycled through a free list instead of going back to free().
  */
-ListResult insert_head_ptr(LinkedList* list, void* data_ptr) {
-    
-    Node* new_node;
-    ListResult result = insert_node_core_generic(list, data_ptr, LIST_MODE_POINTER, &new_node);
-    if (result != LIST_SUCCESS) return result;
+ListResult list_enable_pool(LinkedList* list, size_t nodes_per_chunk) {
 
-    // Link the new node at the head
-    Node* old_first = list->head->next;
-    list->head->next = new_node;
-    new_node->prev = list->head;
-    new_node->next = old_first;
-    old_first->prev = new_node;
-    
-    list->length++;
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION;
+    if (!is_empty(list)) return LIST_ERROR_INVALID_OPERATION; // Existing nodes came from malloc
+
+    struct NodePool* pool = pool_create(list->element_size, nodes_per_chunk);
+    if (!pool) return LIST_ERROR_MEMORY_ALLOC;
+
+    pool_destroy(list->pool);
+    list->pool = pool;
     return LIST_SUCCESS;
 }
 
 /**
- * @brief Inserts a new element at the tail of the list (pointer mode - stores pointer directly).
- * @param list The list to insert into.
- * @param data_ptr A pointer to existing data. The pointer itself is stored, not copied.
+ * @brief Switches the list back to one malloc/free per node and releases the pool.
+ * @param list The list to configure. Must be empty.
  * @return LIST_SUCCESS on success, error code on failure.
- * @warning The caller must ensure the pointed-to data remains valid for the list's lifetime.
  */
-ListResult insert_tail_ptr(LinkedList* list, void* data_ptr) {
-    
-    Node* new_node;
-    ListResult result = insert_node_core_generic(list, data_ptr, LIST_MODE_POINTER, &new_node);
-    if (result != LIST_SUCCESS) return result;
+ListResult list_disable_pool(LinkedList* list) {
 
-    // Link the new node at the tail
-    Node* old_last = list->tail->prev;
-    list->tail->prev = new_node;
-    new_node->next = list->tail;
-    new_node->prev = old_last;
-    old_last->next = new_node;
-    
-    list->length++;
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!is_empty(list)) return LIST_ERROR_INVALID_OPERATION; // Live nodes still belong to the pool
+
+    pool_destroy(list->pool);
+    list->pool = NULL;
     return LIST_SUCCESS;
 }
 
 /**
- * @brief Inserts an element at a specific index (pointer mode - stores pointer directly).
- * @param list The list to insert into.
- * @param index The index to insert at (0-based).
- * @param data_ptr A pointer to existing data. The pointer itself is stored, not copied.
+ * @brief Hands pool chunks that hold no live nodes back to the system allocator.
+ * @param list The pool-backed list.
  * @return LIST_SUCCESS on success, error code on failure.
- * @warning The caller must ensure the pointed-to data remains valid for the list's lifetime.
  */
-ListResult insert_index_ptr(LinkedList* list, size_t index, void* data_ptr) {
-    
-    // Handle boundary conditions
-    if (index <= 0) {
-        // Insert at head for index 0
-        return insert_head_ptr(list, data_ptr);
+ListResult list_shrink_pool(LinkedList* list) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!list->pool) return LIST_ERROR_INVALID_OPERATION;
+
+    struct NodePool* pool = list->pool;
+    if (pool->chunk_count == 0) return LIST_SUCCESS;
+
+    // Count the free slots of every chunk: recycled nodes plus never-used bump slots
+    PoolChunk** sorted = (PoolChunk**)malloc(pool->chunk_count * sizeof(PoolChunk*));
+    size_t* free_slots = (size_t*)calloc(pool->chunk_count, sizeof(size_t));
+    if (!sorted || !free_slots) {
+        free(sorted);
+        free(free_slots);
+        return LIST_ERROR_MEMORY_ALLOC;
     }
-    if (index >= list->length) {
-        // Insert at tail for indices beyond list length
-        return insert_tail_ptr(list, data_ptr);
+
+    size_t count = 0;
+    for (PoolChunk* chunk = pool->chunks; chunk; chunk = chunk->next) {
+        sorted[count++] = chunk;
     }
-    
-    Node* new_node;
-    ListResult result = insert_node_core_generic(list, data_ptr, LIST_MODE_POINTER, &new_node);
-    if (result != LIST_SUCCESS) return result;
-    
-    Node* current;
+    qsort(sorted, count, sizeof(PoolChunk*), compare_chunk_address);
 
-    // Choose direction based on which half the index is in
-    if (index <= list->length / 2) {
-        // Index is in first half - traverse forward from head
-        current = list->head->next;
-        for (size_t i = 0; i < index; i++) {
-            current = current->next;
+    for (Node* node = pool->free_list; node; node = node->next) {
+        free_slots[find_owning_chunk(sorted, count, pool->node_size, node)]++;
+    }
+    if (pool->bump != pool->bump_end) {
+        size_t owner = find_owning_chunk(sorted, count, pool->node_size, (Node*)pool->bump);
+        free_slots[owner] += (size_t)(pool->bump_end - pool->bump) / pool->node_size;
+    }
+
+    // Drop recycled nodes that live in chunks about to be released
+    Node** link = &pool->free_list;
+    while (*link) {
+        size_t owner = find_owning_chunk(sorted, count, pool->node_size, *link);
+        if (free_slots[owner] == sorted[owner]->capacity) {
+            *link = (*link)->next;
+            pool->free_list_length--;
+        } else {
+            link = &(*link)->next;
         }
-    } else {
-        // Index is in second half - traverse backward from tail
-        current = list->tail->prev;
-        for (size_t i = list->length - 1; i > index; i--) {
-            current = current->prev;
+    }
+
+    // Release the fully free chunks
+    PoolChunk** chunk_link = &pool->chunks;
+    while (*chunk_link) {
+        PoolChunk* chunk = *chunk_link;
+        PoolChunk** key = &chunk;
+        size_t owner = (size_t)((PoolChunk**)bsearch(key, sorted, count, sizeof(PoolChunk*), compare_chunk_address) - sorted);
+
+        if (free_slots[owner] == chunk->capacity) {
+            if (pool->bump >= chunk->slots && pool->bump <= chunk->slots + chunk->capacity * pool->node_size) {
+                pool->bump = pool->bump_end = NULL; // The bump chunk is gone
+            }
+            *chunk_link = chunk->next;
+            free(chunk);
+            pool->chunk_count--;
+        } else {
+            chunk_link = &chunk->next;
         }
     }
-    
-    // Insert before current
-    new_node->next = current;
-    new_node->prev = current->prev;
-    current->prev->next = new_node;
-    current->prev = new_node;
-    
-    list->length++;
+
+    free(sorted);
+    free(free_slots);
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Reports how much memory the list's node pool holds.
+ * @param list The pool-backed list.
+ * @param out_stats Receives the counters.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult list_pool_stats(const LinkedList* list, ListPoolStats* out_stats) {
+
+    if (!list || !out_stats) return LIST_ERROR_NULL_POINTER;
+    if (!list->pool) return LIST_ERROR_INVALID_OPERATION;
+
+    const struct NodePool* pool = list->pool;
+    size_t bump_slots = (size_t)(pool->bump_end - pool->bump) / pool->node_size;
+
+    out_stats->chunks = pool->chunk_count;
+    out_stats->live_nodes = pool->live_nodes;
+    out_stats->free_nodes = pool->free_list_length + bump_slots;
+    out_stats->node_size = pool->node_size;
+    out_stats->bytes_reserved = (pool->live_nodes + out_stats->free_nodes) * pool->node_size
+                              + pool->chunk_count * sizeof(PoolChunk);
     return LIST_SUCCESS;
 }
 
 /*
 ┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
 ┃                                               ┃
-┃            4. Deletion Functions              ┃
+┃             2C. Storage Modes                 ┃
 ┃                                               ┃
 ┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
  */
 
-// INTERNAL CORE HELPER FUNCTION for deletion logic
-static ListResult delete_node_core(LinkedList* list, Node* node_to_delete) {
-    
-    if (!list || !node_to_delete) return LIST_ERROR_NULL_POINTER;
-    if (node_to_delete == list->head || node_to_delete == list->tail) {
-        return LIST_ERROR_INVALID_OPERATION; // Cannot delete dummy nodes
+// Element walks: read-only traversals (printing, searching, copying out...) go through an
+// ElementWalk so the same loop serves every storage mode:
+//
+//     ElementWalk walk;
+//     walk_list(&walk, list, START_FROM_HEAD);
+//     for (void* element = walk_next(&walk); element; element = walk_next(&walk)) { ... }
+
+// INTERNAL HELPER FUNCTION starting a walk over every element of 'list'
+static void walk_list(ElementWalk* walk, const LinkedList* list, Direction direction) {
+
+    bool backward = (direction == START_FROM_TAIL);
+    *walk = (ElementWalk){ 0 };
+    walk->storage = list->storage;
+    walk->backward = backward;
+
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        size_t start = backward ? list->length - 1 : 0;
+        walk->element = list->length ? list->elements + (list->first_slot + start) * list->element_size : NULL;
+        walk->remaining = list->length;
+    } else {
+        walk->node = backward ? list->tail->prev : list->head->next;
+        walk->stop = backward ? list->head : list->tail;
     }
+    walk->step = backward ? -(ptrdiff_t)list->element_size : (ptrdiff_t)list->element_size;
+}
 
-    // Re-link the list around the node
-    Node* prev_node = node_to_delete->prev;
-    Node* next_node = node_to_delete->next;
-    prev_node->next = next_node;
-    next_node->prev = prev_node;
-    
-    // Free the data based on ownership mode
-    if (node_to_delete->mode == LIST_MODE_VALUE) {
-        // We allocated the block; free inner fields via callback then free block
-        if (list->free_node_function) {
-            list->free_node_function(node_to_delete->data);
-        }
-        free(node_to_delete->data);
-    } else { // LIST_MODE_POINTER
-        // We only stored user pointer; we now own it so apply free function first then free struct
-        if (list->free_node_function) {
-            list->free_node_function(node_to_delete->data);
-        }
-        free(node_to_delete->data);
-    }
-    
-    // Free the node itself
-    free(node_to_delete);
-    
-    list->length--;
-    return LIST_SUCCESS;
+// INTERNAL HELPER FUNCTION starting a forward walk over the nodes first .. end (end excluded)
+static void walk_nodes(ElementWalk* walk, Node* first, Node* end) {
+    *walk = (ElementWalk){ 0 };
+    walk->node = first;
+    walk->stop = end;
 }
 
-/**
- * @brief Deletes the element at the head of the list.
- * @param list The list to delete from.
- * @return LIST_SUCCESS on success, error code if the list is empty.
- */
-ListResult delete_head(LinkedList* list) {
+static bool walk_next_block(ElementWalk* walk);
 
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (is_empty(list)) return LIST_ERROR_INVALID_OPERATION;
+// INTERNAL HELPER FUNCTION returning the next element of a walk, or NULL when it is over
+static inline void* walk_next(ElementWalk* walk) {
 
-    // Use core deletion logic
-    return delete_node_core(list, list->head->next);
+    if (walk->storage == LIST_STORAGE_NODES) {
+        if (walk->node == walk->stop) return NULL;
+        walk->visited = walk->node;
+        walk->node = walk->backward ? walk->node->prev : walk->node->next;
+        return walk->visited->data;
+    }
+
+    // Contiguous storage is one run of elements; unrolled storage one run per block
+    if (walk->remaining == 0 && (walk->storage == LIST_STORAGE_CONTIGUOUS || !walk_next_block(walk))) {
+        return NULL;
+    }
+    void* element = walk->element;
+    if (--walk->remaining) walk->element += walk->step;
+    return element;
 }
 
+// INTERNAL HELPER FUNCTION returning the next run of elements stored back to back (forward walks
+// only) and its length in 'count': a whole contiguous list, one unrolled block or a single node
+static inline void* walk_next_run(ElementWalk* walk, size_t* count) {
 
-/**
- * @brief Deletes the element at the tail of the list.
- * @param list The list to delete from.
- * @return LIST_SUCCESS on success, error code if the list is empty.
- */
-ListResult delete_tail(LinkedList* list) {
-    
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (is_empty(list)) return LIST_ERROR_INVALID_OPERATION;
+    if (walk->storage == LIST_STORAGE_NODES) {
+        void* element = walk_next(walk);
+        *count = element ? 1 : 0;
+        return element;
+    }
 
-    // Use core deletion logic
-    return delete_node_core(list, list->tail->prev);
+    if (walk->remaining == 0 && (walk->storage == LIST_STORAGE_CONTIGUOUS || !walk_next_block(walk))) {
+        *count = 0;
+        return NULL;
+    }
+    void* run = walk->element;
+    *count = walk->remaining;
+    walk->remaining = 0;
+    return run;
 }
 
-/**
- * @brief Deletes an element at a specific index.
- * @param list The list to delete from.
- * @param index The index to delete at (0-based).
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult delete_index(LinkedList* list, size_t index) {
-    
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (is_empty(list)) return LIST_ERROR_INVALID_OPERATION;
-    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS; // size_t cannot be negative
-    
-    Node* current;
-    
-    // Choose direction based on which half the index is in
-    if (index <= list->length / 2) {
-        // Index is in first half - traverse forward from head
-        current = list->head->next;
-        for (size_t i = 0; i < index; i++) {
-            current = current->next;
-        }
-    } else {
-        // Index is in second half - traverse backward from tail
-        current = list->tail->prev;
-        for (size_t i = list->length - 1; i > index; i--) {
-            current = current->prev;
-        }
+// INTERNAL HELPER FUNCTION for reversing 'count' elements in place ('temp' holds one element)
+static void reverse_elements(unsigned char* elements, size_t count, size_t size, unsigned char* temp) {
+    for (size_t i = 0, j = count - 1; count > 1 && i < j; i++, j--) {
+        memcpy(temp, elements + i * size, size);
+        memcpy(elements + i * size, elements + j * size, size);
+        memcpy(elements + j * size, temp, size);
     }
-    
-    // Use core deletion logic
-    return delete_node_core(list, current);
 }
 
+// INTERNAL HELPER FUNCTION merging the sorted runs [left, mid) and [mid, right) of 'from' into
+// the same slots of 'to'
+static void merge_element_runs(const unsigned char* from, unsigned char* to, size_t left, size_t mid,
+                               size_t right, size_t size, CompareFunction compare_fn) {
 
-/**
- * @brief Advanced removal function with multiple options.
- * @param list The list to remove from.
- * @param data The data to find and remove.
- * @param count Number of occurrences to remove (DELETE_ALL_OCCURRENCES for all).
- * @param order START_FROM_HEAD or START_FROM_TAIL.
- * @return LIST_SUCCESS if at least one element was removed, error code otherwise.
- */
-ListResult remove_advanced(LinkedList* list, int count, Direction order, FilterFunction predicate) {
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (!predicate) return LIST_ERROR_INVALID_OPERATION; // Or define a new error if desired.
-    if (is_empty(list)) return LIST_ERROR_ELEMENT_NOT_FOUND;
-
-    int removed_count = 0;
-    Node* current;
-    Node* end_sentinel;
+    size_t i = left, j = mid, k = left;
 
-    // Set up traversal direction
-    if (order == START_FROM_TAIL) {
-        current = list->tail->prev;
-        end_sentinel = list->head;
-    } else {
-        current = list->head->next;
-        end_sentinel = list->tail;
+    while (i < mid && j < right) {
+        // Take from the right run only when strictly smaller, which keeps the sort stable
+        if (compare_fn(from + j * size, from + i * size) < 0) {
+            memcpy(to + k++ * size, from + j++ * size, size);
+        } else {
+            memcpy(to + k++ * size, from + i++ * size, size);
+        }
     }
+    memcpy(to + k * size, from + i * size, (mid - i) * size);
+    k += mid - i;
+    memcpy(to + k * size, from + j * size, (right - j) * size);
+}
 
-    // Traverse and remove matching elements
-    while (current != end_sentinel && (count == DELETE_ALL_OCCURRENCES || removed_count < count)) {
-        Node* next_node = (order == START_FROM_TAIL) ? current->prev : current->next;
+// INTERNAL HELPER FUNCTION: stable bottom-up merge sort of 'count' elements stored back to back
+static bool sort_elements(unsigned char* elements, size_t count, size_t size, CompareFunction compare_fn) {
 
-        if (predicate(current->data)) {
-            ListResult result = delete_node_core(list, current);
-            if (result == LIST_SUCCESS) {
-                removed_count++;
-            }
+    unsigned char* scratch = malloc(count * size);
+    if (!scratch) return false;
+
+    unsigned char* from = elements;
+    unsigned char* to = scratch;
+
+    for (size_t width = 1; width < count; width *= 2) {
+        for (size_t left = 0; left < count; left += 2 * width) {
+            size_t mid = left + width < count ? left + width : count;
+            size_t right = left + 2 * width < count ? left + 2 * width : count;
+            merge_element_runs(from, to, left, mid, right, size, compare_fn);
         }
+        unsigned char* swap = from;
+        from = to;
+        to = swap;
+    }
 
-        current = next_node;
+    if (from != elements) {
+        memcpy(elements, from, count * size);
     }
+    free(scratch);
+    return true;
+}
 
-    return (removed_count > 0) ? LIST_SUCCESS : LIST_ERROR_ELEMENT_NOT_FOUND;
+// Contiguous storage ("vector mode"): elements live in slots first_slot .. first_slot + length - 1
+// of one buffer. Free slots are kept on both sides, so inserting or deleting at either end is
+// amortized O(1); in the middle, the shorter side is moved.
+
+#define CONTIGUOUS_MIN_CAPACITY 8
+
+// INTERNAL HELPER FUNCTION returning the address of element 'index' (contiguous storage)
+static inline unsigned char* contiguous_at(const LinkedList* list, size_t index) {
+    return list->elements + (list->first_slot + index) * list->element_size;
 }
 
+// INTERNAL HELPER FUNCTION moving the elements to a buffer of 'capacity' slots, starting at 'first_slot'
+static bool contiguous_relocate(LinkedList* list, size_t capacity, size_t first_slot) {
 
-/**
- * @brief Clears all elements from the list (like Python's clear).
- * @param list The list to clear.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult clear(LinkedList* list) {
-    
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    
-    while (!is_empty(list)) {
-        ListResult result = delete_head(list);
-        if (result != LIST_SUCCESS) {
-            return result;
+    size_t size = list->element_size;
+
+    if (capacity == list->capacity) {
+        memmove(list->elements + first_slot * size, contiguous_at(list, 0), list->length * size);
+    } else {
+        if (capacity > SIZE_MAX / size) return false; // The buffer size would wrap
+        unsigned char* elements = malloc(capacity * size);
+        if (!elements) return false;
+        if (list->length) {
+            memcpy(elements + first_slot * size, contiguous_at(list, 0), list->length * size);
         }
+        free(list->elements);
+        list->elements = elements;
+        list->capacity = capacity;
     }
-    
-    return LIST_SUCCESS;
-}
 
-/**
- * @brief Frees all memory associated with the list.
- * This includes all nodes and the data within them (using the free_function if provided).
- * @param list A pointer to the LinkedList to be destroyed.
- */
-void destroy(LinkedList* list) {
-    
-    if (!list) return;
+    list->first_slot = first_slot;
+    return true;
+}
 
-    // Clear all real nodes - ignore errors during destruction
-    clear(list);
+// INTERNAL HELPER FUNCTION making sure there is a free slot in front of (at_front) or after the elements
+static bool contiguous_make_room(LinkedList* list, bool at_front) {
 
-    // Free the dummy nodes
-    free(list->head);
-    free(list->tail);
-    
-    // Free struct name if allocated
-    if (list->struct_name) {
-        free(list->struct_name);
+    if (at_front ? list->first_slot > 0 : list->first_slot + list->length < list->capacity) {
+        return true;
     }
-    
-    // Finally, free the list manager itself
-    free(list);
-}
 
-/*
-┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
-┃                                               ┃
-┃             5. Utility Functions              ┃
-┃                                               ┃
-┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
- */
+    // Plenty of free slots on the other side: re-center instead of growing
+    size_t spare = list->capacity - list->length;
+    if (list->capacity >= CONTIGUOUS_MIN_CAPACITY && spare >= list->capacity / 2) {
+        return contiguous_relocate(list, list->capacity, spare / 2);
+    }
 
-/**
- * @brief Returns the number of elements in the list.
- * @param list The list to query.
- * @return The number of elements.
- */
-size_t get_length(const LinkedList* list) {
-    return list ? list->length : 0;
+    size_t capacity = list->capacity ? list->capacity * 2 : CONTIGUOUS_MIN_CAPACITY;
+    size_t first_slot = at_front ? (capacity - list->length) / 2 : list->first_slot;
+    return contiguous_relocate(list, capacity, first_slot);
 }
 
-/**
- * @brief Checks if the list is empty.
- * @param list The list to check.
- * @return TRUE if the list is empty, FALSE otherwise.
- */
-bool is_empty(const LinkedList* list) {
-    return !list || list->length == 0;
+// INTERNAL HELPER FUNCTION releasing what element 'index' owns (free function only: elements are inline)
+static inline void contiguous_release(LinkedList* list, size_t index) {
+    if (list->free_node_function) {
+        list->free_node_function(contiguous_at(list, index));
+    }
 }
 
-/**
- * @brief Prints all elements in the list using default formatting (with indices and newlines).
- * @param list The list to print.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult print_list(const LinkedList* list) {
-    return print_list_advanced(list, false, true, "\n");
-}
+// INTERNAL HELPER FUNCTION removing element 'index' (contiguous storage)
+static ListResult contiguous_delete(LinkedList* list, size_t index) {
 
+    contiguous_release(list, index);
 
-/**
- * @brief Prints all elements in the list with customizable formatting.
- * @param list The list to print.
- * @param show_size Whether to show the total size of the list.
- * @param show_index Whether to show element indices.
- * @param separator String to print between elements.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult print_list_advanced(const LinkedList* list, bool show_size, bool show_index, const char* separator) {
+    size_t size = list->element_size;
+    if (index < list->length / 2) {
+        // Close the gap from the front
+        memmove(contiguous_at(list, 1), contiguous_at(list, 0), index * size);
+        list->first_slot++;
+    } else {
+        memmove(contiguous_at(list, index), contiguous_at(list, index + 1), (list->length - index - 1) * size);
+    }
 
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (is_empty(list)) return LIST_ERROR_ELEMENT_NOT_FOUND;
-    if (!list->print_node_function) return LIST_ERROR_NO_PRINT_FUNCTION;
-    
-    // Determine starting and ending points (always dummy nodes)
-    Node* current_node = list->head->next;
-    Node* end_node = list->tail;
+    list->length--;
+    if (list->length == 0) list->first_slot = list->capacity / 2;
+    list->version++;
+    return LIST_SUCCESS;
+}
 
-    if (show_size)
-        printf("List len: %zu\n", list->length);
+// INTERNAL HELPER FUNCTION inserting a copy of 'data' at 'index' (contiguous storage, index <= length)
+static ListResult contiguous_insert(LinkedList* list, size_t index, const void* data) {
 
-    size_t index = 0;
-    while(current_node != end_node) {
+    size_t size = list->element_size;
+    bool at_front = (index < list->length / 2);
+    if (!contiguous_make_room(list, at_front)) return LIST_ERROR_MEMORY_ALLOC;
 
-        // Print the index, if required
-        if (show_index)
-            printf("  [%zu]: ", index++);
+    if (at_front) {
+        // Open the slot by moving the first 'index' elements one step towards the front
+        list->first_slot--;
+        memmove(contiguous_at(list, 0), contiguous_at(list, 1), index * size);
+    } else {
+        memmove(contiguous_at(list, index + 1), contiguous_at(list, index), (list->length - index) * size);
+    }
 
-        // Print the element data itself
-        list->print_node_function(current_node->data);
+    memcpy(contiguous_at(list, index), data, size);
+    list->length++;
+    list->version++;
+    return LIST_SUCCESS;
+}
 
-        // Move to the next node
-        current_node = current_node->next;
+// INTERNAL HELPER FUNCTION dropping every element (contiguous storage); the buffer is kept
+static void contiguous_clear(LinkedList* list) {
 
-        // Print the separator (if not the last element)
-        if (current_node != end_node)
-            printf("%s", separator);
+    if (list->free_node_function) {
+        for (size_t i = 0; i < list->length; i++) {
+            contiguous_release(list, i);
+        }
     }
 
-    // Final newline for clean output
-    printf("\n");
-    
-    return LIST_SUCCESS;
+    list->length = 0;
+    list->first_slot = list->capacity / 2;
+    list->version++;
 }
 
+// INTERNAL HELPER FUNCTION for remove_advanced() on contiguous storage: one compaction pass
+static size_t contiguous_remove_matching(LinkedList* list, size_t limit, Direction order, FilterFunction predicate) {
 
-/*
-┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
-┃                                               ┃
-┃        6. Search and Access Functions         ┃
-┃                                               ┃
-┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
- */
-
-// INTERNAL HELPER FUNCTION for finding node by index
-static Node* find_node_by_index(const LinkedList* list, size_t index) {
-    
-    if (!list || index >= list->length) return NULL;
-    
-    Node* current;
+    size_t size = list->element_size;
+    size_t removed = 0;
 
-    // Choose direction based on which half the index is in
-    if (index <= list->length / 2) {
-        // Index is in first half - traverse forward from head
-        current = list->head->next;
-        for (size_t i = 0; i < index; i++) {
-            current = current->next;
+    if (order == START_FROM_TAIL) {
+        // Keep survivors packed against the back, then drop the freed slots at the front
+        size_t write = list->length;
+        for (size_t i = list->length; i-- > 0;) {
+            if (removed < limit && predicate(contiguous_at(list, i))) {
+                contiguous_release(list, i);
+                removed++;
+            } else if (removed > 0) {
+                memcpy(contiguous_at(list, write - 1), contiguous_at(list, i), size);
+                write--;
+            } else {
+                write--;
+            }
+            if (removed == limit) {
+                // Nothing more to remove: slide the untouched front part up as one block
+                memmove(contiguous_at(list, write - i), contiguous_at(list, 0), i * size);
+                break;
+            }
         }
+        list->first_slot += removed;
     } else {
-        // Index is in second half - traverse backward from tail
-        current = list->tail->prev;
-        for (size_t i = list->length - 1; i > index; i--) {
-            current = current->prev;
+        size_t write = 0;
+        size_t i = 0;
+        for (; i < list->length && removed < limit; i++) {
+            if (predicate(contiguous_at(list, i))) {
+                contiguous_release(list, i);
+                removed++;
+            } else {
+                if (write != i) memcpy(contiguous_at(list, write), contiguous_at(list, i), size);
+                write++;
+            }
         }
+        // The rest is untouched: move it down as one block
+        memmove(contiguous_at(list, write), contiguous_at(list, i), (list->length - i) * size);
     }
-    
-    return current;
+
+    list->length -= removed;
+    return removed;
 }
 
+// INTERNAL HELPER FUNCTION for rotate() on contiguous storage: element 'split' becomes the first
+static bool contiguous_rotate(LinkedList* list, size_t split) {
 
-/**
- * @brief Gets a pointer to an element at a specific index (direct access without copying).
- * @param list The list to get from.
- * @param index The index to get.
- * @return Pointer to the data at the specified index, or NULL on failure.
- * @warning The returned pointer is valid only as long as the list structure remains unchanged.
- */
-void* get(const LinkedList* list, size_t index) {
-    
-    if (!list || index >= list->length) return NULL;
-    
-    Node* current = find_node_by_index(list, index);
-    return current ? current->data : NULL;
+    size_t size = list->element_size;
+    size_t moved = list->length - split;
+    unsigned char* temp = malloc((split < moved ? split : moved) * size);
+    if (!temp) return false;
+
+    if (split <= moved) {
+        // Park the (shorter) front part, slide the rest down, put the front part behind it
+        memcpy(temp, contiguous_at(list, 0), split * size);
+        memmove(contiguous_at(list, 0), contiguous_at(list, split), moved * size);
+        memcpy(contiguous_at(list, moved), temp, split * size);
+    } else {
+        memcpy(temp, contiguous_at(list, split), moved * size);
+        memmove(contiguous_at(list, moved), contiguous_at(list, 0), split * size);
+        memcpy(contiguous_at(list, 0), temp, moved * size);
+    }
+
+    free(temp);
+    return true;
 }
 
-/**
- * @brief Returns the index of the first element that satisfies the predicate.
- * @param list The list to search in.
- * @param predicate The function to test each element.
- * @param arg An optional argument to pass to the predicate.
- * @return The index if found, or a negative error code.
- */
-int index_of(const LinkedList* list, PredicateFunction predicate) {
-    return index_of_advanced(list, START_FROM_HEAD, predicate);
+// Unrolled storage: every node holds a block of up to block_capacity elements, behind a small
+// header with the block's element count. Scans touch one node per block and read the elements
+// back to back; inserting in the middle only moves elements inside one block, splitting it when
+// it is full. Deleting merges a block that fell under half full with a neighbour that has room.
+
+#define UNROLLED_HEADER_SIZE \
+    (((sizeof(size_t) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t)) * _Alignof(max_align_t))
+
+// INTERNAL HELPER FUNCTION giving access to the element count of a block
+static inline size_t* block_count(const Node* block) {
+    return (size_t*)block->payload;
 }
 
-/**
- * @brief Returns the index of the first or last element that satisfies the predicate.
- * @param list The list to search in.
- * @param direction START_FROM_HEAD or START_FROM_TAIL.
- * @param predicate The function to test each element.
- * @return The index if found, or a negative error code.
- */
-int index_of_advanced(const LinkedList* list, Direction order, PredicateFunction predicate) {
-    if (!list) return -LIST_ERROR_NULL_POINTER;
-    if (!predicate) return -LIST_ERROR_INVALID_OPERATION;
+// INTERNAL HELPER FUNCTION returning the address of slot 'offset' in a block
+static inline unsigned char* block_slot(const LinkedList* list, const Node* block, size_t offset) {
+    return (unsigned char*)block->data + offset * list->element_size;
+}
 
-    if (order == START_FROM_TAIL) {
-        // Search from tail to head
-        Node* current = list->tail->prev;
-        size_t index = list->length - 1;
-        while (current != list->head) {
-            if (predicate(current->data)) {
-                return (int)index;
-            }
-            current = current->prev;
-            if (index == 0) break; // Prevent underflow
-            index--;
-        }
-    } else {
-        // Search from head to tail (default)
-        Node* current = list->head->next;
-        size_t index = 0;
-        while (current != list->tail) {
-            if (predicate(current->data)) {
-                return (int)index;
-            }
-            current = current->next;
-            index++;
-        }
+// INTERNAL HELPER FUNCTION for continuing a walk with the next block (false when there is none)
+static bool walk_next_block(ElementWalk* walk) {
+
+    while (walk->node != walk->stop) {
+        Node* block = walk->node;
+        walk->node = walk->backward ? block->prev : block->next;
+
+        size_t count = *block_count(block);
+        if (count == 0) continue;
+
+        size_t size = (size_t)(walk->step < 0 ? -walk->step : walk->step);
+        walk->element = (unsigned char*)block->data + (walk->backward ? (count - 1) * size : 0);
+        walk->remaining = count;
+        return true;
     }
-    return -LIST_ERROR_ELEMENT_NOT_FOUND; // Element not found
+    return false;
 }
 
-/**
- * @brief Counts how many elements in the list satisfy a given condition.
- * @param list The list to iterate over.
- * @param predicate A function pointer that returns true if an element satisfies the condition.
- * @param arg An optional argument to pass to the predicate function.
- * @return The number of elements that satisfy the condition.
- */
-size_t count_matching(const LinkedList* list, PredicateFunction predicate) {
-    if (!list || !predicate) return 0;
-    
-    size_t count = 0;
-    Node* current = list->head->next;
-    while (current != list->tail) {
-        if (predicate(current->data)) {
-            count++;
-        }
-        current = current->next;
-    }
-    return count;
+// INTERNAL HELPER FUNCTION allocating an empty block and linking it in front of 'position'
+static Node* unrolled_new_block(LinkedList* list, Node* position) {
+
+    Node* block = malloc(sizeof(Node) + UNROLLED_HEADER_SIZE + list->block_capacity * list->element_size);
+    if (!block) return NULL;
+
+    block->data = block->payload + UNROLLED_HEADER_SIZE;
+    block->mode = LIST_MODE_VALUE;
+    *block_count(block) = 0;
+
+    block->next = position;
+    block->prev = position->prev;
+    position->prev->next = block;
+    position->prev = block;
+    return block;
 }
 
+// INTERNAL HELPER FUNCTION unlinking and freeing a block (its elements must be gone already)
+static void unrolled_free_block(Node* block) {
+    block->prev->next = block->next;
+    block->next->prev = block->prev;
+    free(block);
+}
 
-/**
- * @brief Sets a field value by copying data directly (no memory management).
- * @param list The list containing the element.
- * @param index The index of the element to modify.
- * @param field_offset The byte offset of the field within the struct.
- * @param field_size The size of the field in bytes.
- * @param new_value Pointer to the new value to set.
- * @return LIST_SUCCESS on success, error code on failure.
- * @note Use this for primitive types and when you manage memory yourself.
- */
-ListResult set_field_impl(LinkedList* list, size_t index, size_t field_offset, size_t field_size, const void* new_value) {
-    return set_field_advanced_impl(list, index, field_offset, field_size, new_value, false, false, 0);
+// INTERNAL HELPER FUNCTION appending the elements of the block after 'block' to it and freeing that block
+static void unrolled_absorb_next(LinkedList* list, Node* block) {
+    Node* next = block->next;
+    memcpy(block_slot(list, block, *block_count(block)), next->data, *block_count(next) * list->element_size);
+    *block_count(block) += *block_count(next);
+    unrolled_free_block(next);
 }
 
-/**
- * @brief Sets a dynamically allocated field with proper memory management.
- * @param list The list containing the element.
- * @param index The index of the element to modify.
- * @param field_offset The byte offset of the pointer field within the struct.
- * @param data_size The size of the data to allocate and copy.
- * @param new_data Pointer to the new data to copy.
- * @return LIST_SUCCESS on success, error code on failure.
- * @note This frees old memory, allocates new memory, and copies the data.
- */
-ListResult set_allocated_field_impl(LinkedList* list, size_t index, size_t field_offset, size_t data_size, const void* new_data) {
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    if (field_offset + sizeof(void*) > list->element_size) return LIST_ERROR_INVALID_OPERATION;
+// INTERNAL HELPER FUNCTION for recording a change of the unrolled layout (the finger caches a block)
+static void unrolled_changed(LinkedList* list) {
+    list->version++;
+    list->finger_node = NULL;
+}
 
-    Node* current = find_node_by_index(list, index);
-    if (!current) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    
-    // Calculate the address of the pointer field
-    void** ptr_field = (void**)((char*)current->data + field_offset);
-    
-    // Free old memory if it exists
-    if (*ptr_field) {
-        free(*ptr_field);
+// INTERNAL HELPER FUNCTION finding the block that holds element 'index' (index < length).
+// The finger caches the last block found, together with the index of its first element
+// (moved as by find_node_by_index(), so shared readers may call this).
+static Node* unrolled_locate(const LinkedList* list, size_t index, size_t* out_offset) {
+
+    size_t from_head = index;
+    size_t from_tail = list->length - 1 - index;
+    size_t from_finger = (size_t)-1;
+    Node* finger;
+    size_t finger_index;
+    if (finger_read(list, &finger, &finger_index)) {
+        from_finger = (index >= finger_index) ? index - finger_index : finger_index - index;
     }
-    
-    // Allocate and copy new data
-    if (new_data && data_size > 0) {
-        *ptr_field = malloc(data_size);
-        if (*ptr_field) {
-            memcpy(*ptr_field, new_data, data_size);
-        } else {
-            return LIST_ERROR_MEMORY_ALLOC;
-        }
+
+    Node* block;
+    size_t start;
+    bool hit = (from_finger < from_head && from_finger < from_tail);
+    if (hit) {
+        block = finger;
+        start = finger_index;
+    } else if (from_head <= from_tail) {
+        block = list->head->next;
+        start = 0;
     } else {
-        *ptr_field = NULL;
+        // The dummy tail "starts" right after the last element
+        block = list->tail;
+        start = list->length;
     }
-    
-    return LIST_SUCCESS;
+
+    while (index < start) {
+        block = block->prev;
+        start -= *block_count(block);
+    }
+    while (index >= start + *block_count(block)) {
+        start += *block_count(block);
+        block = block->next;
+    }
+
+    finger_move(list, block, start, hit);
+    *out_offset = index - start;
+    return block;
 }
 
-/**
- * @brief Sets a field with advanced memory management control.
- * @param list The list containing the element.
- * @param index The index of the element to modify.
- * @param field_offset The byte offset of the field within the struct.
- * @param field_size The size of the field in bytes.
- * @param new_value Pointer to the new value or data.
- * @param should_free_old Whether to free existing memory (for pointer fields).
- * @param should_alloc_new Whether to allocate new memory and copy data.
- * @param data_size Size of data to allocate (when should_alloc_new is true).
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult set_field_advanced_impl(LinkedList* list, size_t index, size_t field_offset, size_t field_size, 
-                                   const void* new_value, bool should_free_old, bool should_alloc_new, size_t data_size) {
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    if (field_offset + field_size > list->element_size) return LIST_ERROR_INVALID_OPERATION;
+// INTERNAL HELPER FUNCTION inserting a copy of 'data' at 'index' (unrolled storage, index <= length)
+static ListResult unrolled_insert(LinkedList* list, size_t index, const void* data) {
 
-    Node* current = find_node_by_index(list, index);
-    if (!current) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    
-    // Handle different memory management modes
-    if (field_size == sizeof(void*) && (should_free_old || should_alloc_new)) {
-        // This is likely a pointer field with memory management
-        void** ptr_field = (void**)((char*)current->data + field_offset);
-        
-        // Free old memory if requested
-        if (should_free_old && *ptr_field) {
-            free(*ptr_field);
-            *ptr_field = NULL;
+    size_t size = list->element_size;
+    size_t capacity = list->block_capacity;
+    Node* block;
+    size_t offset;
+
+    if (index == list->length) {
+        block = list->tail->prev;
+        offset = (block == list->head) ? 0 : *block_count(block);
+    } else {
+        block = unrolled_locate(list, index, &offset);
+        // At a block boundary the previous block may still have room
+        if (offset == 0 && block->prev != list->head && *block_count(block->prev) < capacity) {
+            block = block->prev;
+            offset = *block_count(block);
         }
-        
-        // Set new value based on allocation mode
-        if (should_alloc_new && new_value && data_size > 0) {
-            // Allocate new memory and copy data
-            *ptr_field = malloc(data_size);
-            if (!*ptr_field) return LIST_ERROR_MEMORY_ALLOC;
-            memcpy(*ptr_field, new_value, data_size);
-        } else if (new_value) {
-            // Just store the provided pointer (could be NULL)
-            // Cast away const since we're storing it as void*
-            *ptr_field = (void*)(uintptr_t)new_value;
+    }
+
+    if (block == list->head || *block_count(block) == capacity) {
+        if (block == list->head || offset == *block_count(block)) {
+            // Empty list, or appending behind a full block: start a new block
+            block = unrolled_new_block(list, block == list->head ? list->tail : block->next);
+            offset = 0;
+        } else if (offset == 0) {
+            // In front of a full block
+            block = unrolled_new_block(list, block);
         } else {
-            // Set to NULL
-            *ptr_field = NULL;
-        }
-    } else {
-        // Simple field assignment using memcpy (equivalent to set_field_impl)
-        if (new_value) {
-            char* field_ptr = (char*)current->data + field_offset;
-            memcpy(field_ptr, new_value, field_size);
+            // In the middle of a full block: its upper half moves to a new block right after it
+            Node* upper = unrolled_new_block(list, block->next);
+            if (!upper) return LIST_ERROR_MEMORY_ALLOC;
+
+            size_t keep = (capacity + 1) / 2;
+            memcpy(upper->data, block_slot(list, block, keep), (capacity - keep) * size);
+            *block_count(upper) = capacity - keep;
+            *block_count(block) = keep;
+            if (offset > keep) {
+                block = upper;
+                offset -= keep;
+            }
         }
+        if (!block) return LIST_ERROR_MEMORY_ALLOC;
     }
-    
+
+    memmove(block_slot(list, block, offset + 1), block_slot(list, block, offset),
+            (*block_count(block) - offset) * size);
+    memcpy(block_slot(list, block, offset), data, size);
+    (*block_count(block))++;
+    list->length++;
+    unrolled_changed(list);
     return LIST_SUCCESS;
 }
 
-/*
-┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
-┃                                               ┃
-┃             6B. Node Setting Functions        ┃
-┃                                               ┃
-┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
- */
+// INTERNAL HELPER FUNCTION removing element 'index' (unrolled storage)
+static ListResult unrolled_delete(LinkedList* list, size_t index) {
+
+    size_t offset;
+    Node* block = unrolled_locate(list, index, &offset);
+    size_t* count = block_count(block);
 
-/**
- * @brief Replaces an entire element by value at the specified index.
- * @param list The list to modify.
- * @param index The index of the element to replace.
- * @param new_value Pointer to the new value to copy into place.
- * @return LIST_SUCCESS on success, error code on failure.
- * 
- * This function directly replaces the data in the existing node instead of deleting and inserting.
- * This is more efficient and avoids memory management issues.
- */
-ListResult set_node_value_impl(LinkedList* list, size_t index, const void* new_value) {
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (!new_value) return LIST_ERROR_NULL_POINTER;
-    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    
-    Node* current = find_node_by_index(list, index);
-    if (!current) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    
-    // Free the old data if there's a free function
     if (list->free_node_function) {
-        list->free_node_function(current->data);
+        list->free_node_function(block_slot(list, block, offset));
     }
-    
-    // Copy the new data into the existing node
-    memcpy(current->data, new_value, list->element_size);
-    
+    memmove(block_slot(list, block, offset), block_slot(list, block, offset + 1),
+            (*count - offset - 1) * list->element_size);
+    (*count)--;
+    list->length--;
+
+    size_t capacity = list->block_capacity;
+    if (*count == 0) {
+        unrolled_free_block(block);
+    } else if (*count < capacity / 2) {
+        // Under half full: merge with a neighbour if both fit into one block
+        if (block->next != list->tail && *count + *block_count(block->next) <= capacity) {
+            unrolled_absorb_next(list, block);
+        } else if (block->prev != list->head && *block_count(block->prev) + *count <= capacity) {
+            unrolled_absorb_next(list, block->prev);
+        }
+    }
+
+    unrolled_changed(list);
     return LIST_SUCCESS;
 }
 
-/**
- * @brief Replaces an entire element by pointer at the specified index.
- * @param list The list to modify.
- * @param index The index of the element to replace.
- * @param new_value_ptr Pointer to the new element (ownership transfers to list).
- * @return LIST_SUCCESS on success, error code on failure.
- * 
- * This function directly replaces the data in the existing node with the provided pointer data.
- */
-ListResult set_node_ptr_impl(LinkedList* list, size_t index, void* new_value_ptr) {
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (!new_value_ptr) return LIST_ERROR_NULL_POINTER;
-    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    
-    Node* current = find_node_by_index(list, index);
-    if (!current) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
-    
-    // Free the old data if there's a free function
-    if (list->free_node_function) {
-        list->free_node_function(current->data);
+// INTERNAL HELPER FUNCTION freeing every block (unrolled storage)
+static void unrolled_clear(LinkedList* list) {
+
+    Node* block = list->head->next;
+    while (block != list->tail) {
+        Node* next = block->next;
+        if (list->free_node_function) {
+            for (size_t i = 0; i < *block_count(block); i++) {
+                list->free_node_function(block_slot(list, block, i));
+            }
+        }
+        free(block);
+        block = next;
     }
-    
-    // Copy the new data from the pointer into the existing node
-    memcpy(current->data, new_value_ptr, list->element_size);
-    
-    // Free the provided pointer since we copied its contents
-    free(new_value_ptr);
-    
-    return LIST_SUCCESS;
+
+    list->head->next = list->tail;
+    list->tail->prev = list->head;
+    list->length = 0;
+    unrolled_changed(list);
 }
 
-/*
-┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
-┃                                               ┃
-┃             7. Sorting Functions              ┃
-┃                                               ┃
-┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
- */
+// INTERNAL HELPER FUNCTION for remove_advanced() on unrolled storage: compacts each block in
+// place, then frees the emptied blocks and merges neighbours that fit into one block
+static size_t unrolled_remove_matching(LinkedList* list, size_t limit, Direction order, FilterFunction predicate) {
+
+    size_t size = list->element_size;
+    size_t removed = 0;
+    bool backward = (order == START_FROM_TAIL);
+
+    for (Node* block = backward ? list->tail->prev : list->head->next;
+         block != (backward ? list->head : list->tail) && removed < limit;
+         block = backward ? block->prev : block->next) {
+
+        size_t count = *block_count(block);
+        size_t kept = 0;
+
+        if (backward) {
+            // Pack the survivors against the end of the block, then move them to its start
+            size_t write = count;
+            for (size_t i = count; i-- > 0;) {
+                unsigned char* element = block_slot(list, block, i);
+                if (removed < limit && predicate(element)) {
+                    if (list->free_node_function) list->free_node_function(element);
+                    removed++;
+                } else {
+                    write--;
+                    if (write != i) memcpy(block_slot(list, block, write), element, size);
+                }
+            }
+            kept = count - write;
+            memmove(block->data, block_slot(list, block, write), kept * size);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                unsigned char* element = block_slot(list, block, i);
+                if (removed < limit && predicate(element)) {
+                    if (list->free_node_function) list->free_node_function(element);
+                    removed++;
+                } else {
+                    if (kept != i) memcpy(block_slot(list, block, kept), element, size);
+                    kept++;
+                }
+            }
+        }
 
-/**
- * @brief Sorts the list in place (ascending order).
- * @param list The list to sort.
- * @param compare_fn Comparison function.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult sort_list(LinkedList* list, CompareFunction compare_fn) {
+        list->length -= count - kept;
+        *block_count(block) = kept;
+    }
 
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (!compare_fn) return LIST_ERROR_NO_COMPARE_FUNCTION;
-    if (list->length <= 1) return LIST_SUCCESS;
-    
-    bool swapped;
-    do {
-        swapped = false;
-        Node* current = list->head->next;
-        
-        while (current->next != list->tail) {
-            Node* next_node = current->next;
-            
-            int comparison = compare_fn(current->data, next_node->data);
-            if (comparison > 0) {
-                // Swap the data pointers (not the nodes themselves)
-                void* temp_data = current->data;
-                current->data = next_node->data;
-                next_node->data = temp_data;
-                swapped = true;
+    if (removed == 0) return 0;
+
+    Node* block = list->head->next;
+    while (block != list->tail) {
+        Node* next = block->next;
+        if (*block_count(block) == 0) {
+            unrolled_free_block(block);
+        } else {
+            while (next != list->tail && *block_count(block) + *block_count(next) <= list->block_capacity) {
+                unrolled_absorb_next(list, block);
+                next = block->next;
             }
-            
-            current = next_node;
         }
-    } while (swapped);
-    
-    return LIST_SUCCESS;
+        block = next;
+    }
+
+    unrolled_changed(list);
+    return removed;
 }
 
-/*
+// INTERNAL HELPER FUNCTION copying every element of an unrolled list into 'array', in order
+static void unrolled_gather(const LinkedList* list, unsigned char* array) {
+    for (Node* block = list->head->next; block != list->tail; block = block->next) {
+        size_t bytes = *block_count(block) * list->element_size;
+        memcpy(array, block->data, bytes);
+        array += bytes;
+    }
+}
+
+// INTERNAL HELPER FUNCTION writing the elements of 'array' back into the blocks (same counts),
+// starting with array element 'start' and wrapping around at the end
+static void unrolled_scatter(LinkedList* list, const unsigned char* array, size_t start) {
+
+    size_t size = list->element_size;
+    size_t source = start;
+
+    for (Node* block = list->head->next; block != list->tail; block = block->next) {
+        size_t done = 0;
+        while (done < *block_count(block)) {
+            size_t run = *block_count(block) - done;
+            if (run > list->length - source) run = list->length - source;
+            memcpy(block_slot(list, block, done), array + source * size, run * size);
+            done += run;
+            source += run;
+            if (source == list->length) source = 0;
+        }
+    }
+}
+
+// INTERNAL HELPER FUNCTION for sort_list() and rotate() on unrolled storage: rearranges a flat copy
+// (sorted, or read from 'split' on) and writes it back. 'compare_fn' NULL means rotate.
+static bool unrolled_rearrange(LinkedList* list, CompareFunction compare_fn, size_t split) {
+
+    unsigned char* array = malloc(list->length * list->element_size);
+    if (!array) return false;
+
+    unrolled_gather(list, array);
+    if (compare_fn && !sort_elements(array, list->length, list->element_size, compare_fn)) {
+        free(array);
+        return false;
+    }
+    unrolled_scatter(list, array, compare_fn ? 0 : split);
+
+    free(array);
+    return true;
+}
+
+// INTERNAL HELPER FUNCTION for reverse() on unrolled storage: reverses the block chain and each block
+static bool unrolled_reverse(LinkedList* list) {
+
+    unsigned char* temp = malloc(list->element_size);
+    if (!temp) return false;
+
+    Node* old_first = list->head->next;
+    Node* old_last = list->tail->prev;
+
+    Node* block = old_first;
+    while (block != list->tail) {
+        Node* next = block->next;
+        block->next = block->prev;
+        block->prev = next;
+        reverse_elements(block->data, *block_count(block), list->element_size, temp);
+        block = next;
+    }
+
+    list->head->next = old_last;
+    old_last->prev = list->head;
+    list->tail->prev = old_first;
+    old_first->next = list->tail;
+    list->finger_node = NULL; // Every block now starts at a different index
+
+    free(temp);
+    return true;
+}
+
+// Storage dispatch: the public functions handle node storage themselves and hand everything
+// else to these. Size limits and pointer-mode ownership are applied here for both array-like modes.
+
+// INTERNAL HELPER FUNCTION removing element 'index' (array-like storage)
+static ListResult storage_delete(LinkedList* list, size_t index) {
+
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    return list->storage == LIST_STORAGE_CONTIGUOUS ? contiguous_delete(list, index)
+                                                     : unrolled_delete(list, index);
+}
+
+// INTERNAL HELPER FUNCTION inserting a copy of 'data' at 'index' (clamped to the length)
+static ListResult storage_insert(LinkedList* list, size_t index, const void* data) {
+
+    if (!list || !data) return LIST_ERROR_NULL_POINTER;
+
+    // Respect the size limit, exactly like the node storage does
+    size_t evict = 0;
+    if (list->max_size != UNLIMITED && list->length >= list->max_size) {
+        if (list->allow_overwrite == REJECT_NEW_WHEN_FULL) return LIST_ERROR_LIST_FULL;
+        if (list->length == 0) return LIST_ERROR_INVALID_OPERATION; // max_size 0 never has room
+        evict = list->length - list->max_size + 1;
+    }
+
+    // Like the node storage, 'index' is applied after the eviction. The element goes in first
+    // (shifted past the elements about to leave) so a failed allocation loses nothing.
+    if (index > list->length - evict) index = list->length - evict;
+
+    ListResult result = list->storage == LIST_STORAGE_CONTIGUOUS ? contiguous_insert(list, index + evict, data)
+                                                                  : unrolled_insert(list, index + evict, data);
+    if (result != LIST_SUCCESS) return result;
+
+    while (evict-- > 0) {
+        storage_delete(list, 0);
+    }
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION dropping every element (array-like storage)
+static void storage_clear(LinkedList* list) {
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        contiguous_clear(list);
+    } else {
+        unrolled_clear(list);
+    }
+}
+
+// INTERNAL HELPER FUNCTION for remove_advanced() (array-like storage)
+static ListResult storage_remove_matching(LinkedList* list, int count, Direction order, FilterFunction predicate) {
+
+    size_t limit = (count == DELETE_ALL_OCCURRENCES) ? list->length : (size_t)(count < 0 ? 0 : count);
+    size_t removed = list->storage == LIST_STORAGE_CONTIGUOUS
+                         ? contiguous_remove_matching(list, limit, order, predicate)
+                         : unrolled_remove_matching(list, limit, order, predicate);
+
+    if (removed == 0) return LIST_ERROR_ELEMENT_NOT_FOUND;
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION for sort_list() (array-like storage, at least two elements)
+static ListResult storage_sort(LinkedList* list, CompareFunction compare_fn) {
+
+    bool sorted = list->storage == LIST_STORAGE_CONTIGUOUS
+                      ? sort_elements(contiguous_at(list, 0), list->length, list->element_size, compare_fn)
+                      : unrolled_rearrange(list, compare_fn, 0);
+    if (!sorted) return LIST_ERROR_MEMORY_ALLOC;
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION for reverse() (array-like storage, at least two elements)
+static ListResult storage_reverse(LinkedList* list) {
+
+    bool reversed;
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        unsigned char* temp = malloc(list->element_size);
+        reversed = (temp != NULL);
+        if (temp) reverse_elements(contiguous_at(list, 0), list->length, list->element_size, temp);
+        free(temp);
+    } else {
+        reversed = unrolled_reverse(list);
+    }
+    if (!reversed) return LIST_ERROR_MEMORY_ALLOC;
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION for rotate() (array-like storage): element 'split' becomes the first
+static ListResult storage_rotate(LinkedList* list, size_t split) {
+
+    bool rotated = list->storage == LIST_STORAGE_CONTIGUOUS ? contiguous_rotate(list, split)
+                                                             : unrolled_rearrange(list, NULL, split);
+    if (!rotated) return LIST_ERROR_MEMORY_ALLOC;
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION returning element 'index' of any storage (NULL if out of range).
+// 'cache' is as for find_node_by_index(): the list itself on paths that modify it, else NULL.
+static void* element_at(const LinkedList* list, size_t index, LinkedList* cache) {
+
+    if (index >= list->length) return NULL;
+
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) return contiguous_at(list, index);
+    if (list->storage == LIST_STORAGE_UNROLLED) {
+        size_t offset;
+        Node* block = unrolled_locate(list, index, &offset);
+        return block_slot(list, block, offset);
+    }
+
+    Node* node = find_node_by_index(list, index, cache);
+    return node ? node->data : NULL;
+}
+
+// INTERNAL HELPER FUNCTION copying every element into 'array' (array-like storage)
+static void storage_copy_out(const LinkedList* list, void* array) {
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        memcpy(array, contiguous_at(list, 0), list->length * list->element_size);
+    } else {
+        unrolled_gather(list, array);
+    }
+}
+
+/**
+ * @brief Makes room for at least 'capacity' elements up front, so that many insertions do not allocate.
+ * @param list The list to prepare (contiguous storage).
+ * @param capacity Number of elements to make room for.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note For node lists use list_enable_pool() and set_ring_buffer() instead.
+ */
+ListResult list_reserve(LinkedList* list, size_t capacity) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (list->storage != LIST_STORAGE_CONTIGUOUS) return LIST_ERROR_INVALID_OPERATION;
+    if (capacity <= list->capacity - list->first_slot) return LIST_SUCCESS; // Enough room at the back
+
+    // Appends are the common case, so all the room goes behind the elements
+    if (!contiguous_relocate(list, capacity > list->capacity ? capacity : list->capacity, 0)) {
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+    return LIST_SUCCESS;
+}
+
+/*
 ┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
 ┃                                               ┃
-┃         8. Structural Transformations         ┃
+┃         3. Insertion in Linked List           ┃
 ┃                                               ┃
 ┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
  */
 
-// INTERNAL HELPER to copy all function pointers from a source list to a destination list.
-static void copy_list_configuration(LinkedList* dest, const LinkedList* src) {
+// INTERNAL HELPER FUNCTION for storing an element in a node (new or recycled)
+static void fill_node(LinkedList* list, Node* node, void* data, ListMemoryMode mode) {
+
+    if (mode == LIST_MODE_VALUE) {
+        // Value mode: the element is copied into the node's inline payload
+        node->data = node->payload;
+        memcpy(node->data, data, list->element_size);
+    } else {
+        // Pointer mode: store pointer directly (ownership of the pointed block transfers to list)
+        node->data = data;
+        list->pointer_nodes++;
+    }
     
-    if (!dest || !src) return;
+    // Initialize pointers & mode
+    node->next = NULL;
+    node->prev = NULL;
+    node->mode = mode;
+}
+
+// INTERNAL HELPER FUNCTION for creating a new node (unified for both modes)
+static Node* create_node_generic(LinkedList* list, void* data, ListMemoryMode mode) {
     
-    dest->print_node_function = src->print_node_function;
-    dest->free_node_function = src->free_node_function;
-    dest->copy_node_function = src->copy_node_function;
+    // One allocation holds the node header (and, in value mode, the element right after it)
+    Node* new_node = allocate_node(list, mode);
+    if (!new_node) return NULL;
+
+    fill_node(list, new_node, data, mode);
+    return new_node;
+}
+
+// INTERNAL HELPER FUNCTION: can this node's memory hold an element inserted in 'mode'?
+// Pointer-mode nodes from malloc have no payload; pool slots always do. Borrowed nodes belong to
+// their file mapping and are never reused.
+static bool node_can_hold(const LinkedList* list, const Node* node, ListMemoryMode mode) {
+    if (node->mode == LIST_MODE_BORROWED) return false;
+    return mode == LIST_MODE_POINTER || node->mode == LIST_MODE_VALUE || list->pool;
+}
+
+// INTERNAL HELPER FUNCTION for enforcing max_size before an insertion.
+// With DELETE_OLD_WHEN_FULL the oldest element is evicted, and 'out_node' receives an unlinked node
+// for the new element: the last evicted one when it can hold it, otherwise a freshly allocated one.
+// The replacement is secured before anything is evicted, so a failed allocation loses no element.
+static ListResult make_room_for_insert(LinkedList* list, ListMemoryMode mode, Node** out_node) {
+
+    *out_node = NULL;
+
+    // If unlimited size or current length is within limits - no action needed
+    if (list->max_size == UNLIMITED || list->length < list->max_size) {
+        return LIST_SUCCESS;
+    }
+
+    // If we reach this point, the list is full, but overwrite is not allowed
+    if (list->allow_overwrite == REJECT_NEW_WHEN_FULL) {
+        return LIST_ERROR_LIST_FULL;
+    }
+    if (list->length == 0) return LIST_ERROR_INVALID_OPERATION; // max_size 0 never has room
+
+    // Oldest elements (from head) go until there is room for exactly one more (FIFO behavior);
+    // 'last' is the final one to go
+    Node* last = list->head->next;
+    for (size_t i = list->max_size; i < list->length; i++) {
+        last = last->next;
+    }
+
+    Node* fresh = NULL;
+    if (!node_can_hold(list, last, mode)) {
+        fresh = allocate_node(list, mode);
+        if (!fresh) return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    while (list->head->next != last) {
+        delete_node_core(list, list->head->next, 0);
+    }
+
+    if (fresh) {
+        delete_node_core(list, last, 0);
+        *out_node = fresh;
+        return LIST_SUCCESS;
+    }
+
+    // Last eviction: release the element but keep the node for the new one
+    note_node_removed(list, last, 0);
+    last->prev->next = last->next;
+    last->next->prev = last->prev;
+    list->length--;
+
+    if (list->free_node_function) {
+        list->free_node_function(last->data);
+    }
+    if (last->mode == LIST_MODE_POINTER) {
+        free(last->data);
+        list->pointer_nodes--;
+    }
+
+    *out_node = last;
+    return LIST_SUCCESS;
+}
+
+// INTERNAL CORE HELPER FUNCTION for insertion logic (unified for both modes)
+static ListResult insert_node_core_generic(LinkedList* list, void* data, ListMemoryMode mode, Node** out_new_node) {
     
-    // Copy struct name
-    if (src->struct_name) {
-        dest->struct_name = malloc(strlen(src->struct_name) + 1);
-        if (dest->struct_name) {
-            strcpy(dest->struct_name, src->struct_name);
-        }
+    // Input validation
+    if (!list || !data) return LIST_ERROR_NULL_POINTER;
+
+    // Respect the size limit (may evict the oldest element and hand us a node for the new one)
+    Node* node;
+    ListResult result = make_room_for_insert(list, mode, &node);
+    if (result != LIST_SUCCESS) return result;
+
+    if (node) {
+        fill_node(list, node, data, mode);
+        *out_new_node = node;
+        return LIST_SUCCESS;
     }
+
+    // Create new node using generic function
+    Node* new_node = create_node_generic(list, data, mode);
+    if (!new_node) return LIST_ERROR_MEMORY_ALLOC;
+    
+    *out_new_node = new_node;
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION for linking a new node in front of 'position' (a real node or the dummy tail).
+// 'index' is the index the new node ends up at.
+static void link_node_before(LinkedList* list, Node* new_node, Node* position, size_t index) {
+
+    new_node->next = position;
+    new_node->prev = position->prev;
+    position->prev->next = new_node;
+    position->prev = new_node;
+
+    list->length++;
+    note_node_inserted(list, new_node, index);
+}
+
+// INTERNAL HELPER FUNCTION for finding the node an insertion at 'index' goes in front of
+// ('cache' as for find_node_by_index())
+static Node* find_insert_position(const LinkedList* list, size_t index, LinkedList* cache) {
+
+    // Indices beyond the list length insert at the tail
+    Node* position = find_node_by_index(list, index, cache);
+    return position ? position : list->tail;
+}
+
+// INTERNAL HELPER FUNCTION for the index an insertion at 'index' really lands on
+static size_t clamp_insert_index(const LinkedList* list, size_t index) {
+    return index < list->length ? index : list->length;
 }
 
 /**
- * @brief Creates a copy of the list.
- * @param list The list to copy.
- * @return A new list that is a copy of the original, or NULL on failure.
+ * @brief Inserts a new element at the head of the list (value mode - copies data).
+ * @param list The list to insert into.
+ * @param data A pointer to the data to be copied into the list.
+ * @return LIST_SUCCESS on success, error code on failure.
  */
-LinkedList* copy(const LinkedList* list) {
+ListResult insert_head_value_internal(LinkedList* list, void* data) {
+
+    if (list && list->storage != LIST_STORAGE_NODES) {
+        return storage_insert(list, 0, data);
+    }
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data, LIST_MODE_VALUE, &new_node);
+    if (result != LIST_SUCCESS) return result;
+
+    // Link the new node at the head
+    link_node_before(list, new_node, list->head->next, 0);
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Inserts a new element at the tail of the list (value mode - copies data).
+ * @param list The list to insert into.
+ * @param data A pointer to the data to be copied into the list.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult insert_tail_value_internal(LinkedList* list, void* data) {
+
+    if (list && list->storage != LIST_STORAGE_NODES) {
+        return storage_insert(list, SIZE_MAX, data);
+    }
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data, LIST_MODE_VALUE, &new_node);
+    if (result != LIST_SUCCESS) return result;
+
+    // Link the new node at the tail
+    link_node_before(list, new_node, list->tail, list->length);
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Inserts an element at a specific index (value mode - copies data).
+ * @param list The list to insert into.
+ * @param index The index to insert at (0-based).
+ * @param data The data to copy into the list.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult insert_index_value_internal(LinkedList* list, size_t index, void* data) {
+
+    if (list && list->storage != LIST_STORAGE_NODES) {
+        return storage_insert(list, index, data);
+    }
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data, LIST_MODE_VALUE, &new_node);
+    if (result != LIST_SUCCESS) return result;
+    
+    // Insert before the element currently at 'index' (looked up after any eviction)
+    link_node_before(list, new_node, find_insert_position(list, index, list), clamp_insert_index(list, index));
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Inserts a new element at the head of the list (pointer mode - copies pointed data).
+ * @param list The list to insert into.
+ * @param data_ptr A pointer to data to be copied into the list.
+ * @return LIST_SUCCESS on success, error code on failure (LIST_ERROR_INVALID_OPERATION for
+ *         contiguous or unrolled storage, which cannot keep the caller's block).
+ */
+ListResult insert_head_ptr(LinkedList* list, void* data_ptr) {
+
+    // Array-like storage cannot keep the caller's block, which node storage stores as is
+    if (list && list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION;
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data_ptr, LIST_MODE_POINTER, &new_node);
+    if (result != LIST_SUCCESS) return result;
+
+    // Link the new node at the head
+    link_node_before(list, new_node, list->head->next, 0);
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Inserts a new element at the tail of the list (pointer mode - stores pointer directly).
+ * @param list The list to insert into.
+ * @param data_ptr A pointer to existing data. The pointer itself is stored, not copied.
+ * @return LIST_SUCCESS on success, error code on failure (LIST_ERROR_INVALID_OPERATION for
+ *         contiguous or unrolled storage, which cannot keep the caller's block).
+ * @warning The caller must ensure the pointed-to data remains valid for the list's lifetime.
+ */
+ListResult insert_tail_ptr(LinkedList* list, void* data_ptr) {
+
+    // Array-like storage cannot keep the caller's block, which node storage stores as is
+    if (list && list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION;
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data_ptr, LIST_MODE_POINTER, &new_node);
+    if (result != LIST_SUCCESS) return result;
+
+    // Link the new node at the tail
+    link_node_before(list, new_node, list->tail, list->length);
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Inserts an element at a specific index (pointer mode - stores pointer directly).
+ * @param list The list to insert into.
+ * @param index The index to insert at (0-based).
+ * @param data_ptr A pointer to existing data. The pointer itself is stored, not copied.
+ * @return LIST_SUCCESS on success, error code on failure (LIST_ERROR_INVALID_OPERATION for
+ *         contiguous or unrolled storage, which cannot keep the caller's block).
+ * @warning The caller must ensure the pointed-to data remains valid for the list's lifetime.
+ */
+ListResult insert_index_ptr(LinkedList* list, size_t index, void* data_ptr) {
+
+    // Array-like storage cannot keep the caller's block, which node storage stores as is
+    if (list && list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION;
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data_ptr, LIST_MODE_POINTER, &new_node);
+    if (result != LIST_SUCCESS) return result;
+    
+    // Insert before the element currently at 'index' (looked up after any eviction)
+    link_node_before(list, new_node, find_insert_position(list, index, list), clamp_insert_index(list, index));
+    return LIST_SUCCESS;
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃            4. Deletion Functions              ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// INTERNAL CORE HELPER FUNCTION for deletion logic.
+// 'index' is the node's position, or LIST_INDEX_UNKNOWN when the caller does not track it.
+static ListResult delete_node_core(LinkedList* list, Node* node_to_delete, size_t index) {
+    
+    if (!list || !node_to_delete) return LIST_ERROR_NULL_POINTER;
+    if (node_to_delete == list->head || node_to_delete == list->tail) {
+        return LIST_ERROR_INVALID_OPERATION; // Cannot delete dummy nodes
+    }
+
+    note_node_removed(list, node_to_delete, index);
+
+    // Re-link the list around the node
+    Node* prev_node = node_to_delete->prev;
+    Node* next_node = node_to_delete->next;
+    prev_node->next = next_node;
+    next_node->prev = prev_node;
+    
+    // Let the user release anything the element owns (e.g. strings inside a struct)
+    if (list->free_node_function && node_to_delete->mode != LIST_MODE_BORROWED) {
+        list->free_node_function(node_to_delete->data);
+    }
+
+    // Value mode data lives inside the node; pointer mode data is a separate block we now own
+    if (node_to_delete->mode == LIST_MODE_POINTER) {
+        free(node_to_delete->data);
+        list->pointer_nodes--;
+    }
+    
+    // Free the node itself
+    release_node(list, node_to_delete);
+    
+    list->length--;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Deletes the element at the head of the list.
+ * @param list The list to delete from.
+ * @return LIST_SUCCESS on success, error code if the list is empty.
+ */
+ListResult delete_head(LinkedList* list) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (is_empty(list)) return LIST_ERROR_INVALID_OPERATION;
+    if (list->storage != LIST_STORAGE_NODES) return storage_delete(list, 0);
+
+    // Use core deletion logic
+    return delete_node_core(list, list->head->next, 0);
+}
+
+
+/**
+ * @brief Deletes the element at the tail of the list.
+ * @param list The list to delete from.
+ * @return LIST_SUCCESS on success, error code if the list is empty.
+ */
+ListResult delete_tail(LinkedList* list) {
+    
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (is_empty(list)) return LIST_ERROR_INVALID_OPERATION;
+    if (list->storage != LIST_STORAGE_NODES) return storage_delete(list, list->length - 1);
+
+    // Use core deletion logic
+    return delete_node_core(list, list->tail->prev, list->length - 1);
+}
+
+/**
+ * @brief Deletes an element at a specific index.
+ * @param list The list to delete from.
+ * @param index The index to delete at (0-based).
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult delete_index(LinkedList* list, size_t index) {
+    
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (is_empty(list)) return LIST_ERROR_INVALID_OPERATION;
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS; // size_t cannot be negative
+    if (list->storage != LIST_STORAGE_NODES) return storage_delete(list, index);
+    
+    Node* current = find_node_by_index(list, index, list);
+    
+    // Use core deletion logic
+    return delete_node_core(list, current, index);
+}
+
+
+/**
+ * @brief Advanced removal function with multiple options.
+ * @param list The list to remove from.
+ * @param data The data to find and remove.
+ * @param count Number of occurrences to remove (DELETE_ALL_OCCURRENCES for all).
+ * @param order START_FROM_HEAD or START_FROM_TAIL.
+ * @return LIST_SUCCESS if at least one element was removed, error code otherwise.
+ */
+ListResult remove_advanced(LinkedList* list, int count, Direction order, FilterFunction predicate) {
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!predicate) return LIST_ERROR_INVALID_OPERATION; // Or define a new error if desired.
+    if (is_empty(list)) return LIST_ERROR_ELEMENT_NOT_FOUND;
+    if (list->storage != LIST_STORAGE_NODES) return storage_remove_matching(list, count, order, predicate);
+
+    int removed_count = 0;
+    Node* current;
+    Node* end_sentinel;
+    size_t index;
+
+    // Set up traversal direction
+    if (order == START_FROM_TAIL) {
+        current = list->tail->prev;
+        end_sentinel = list->head;
+        index = list->length - 1;
+    } else {
+        current = list->head->next;
+        end_sentinel = list->tail;
+        index = 0;
+    }
+
+    // Traverse and remove matching elements
+    while (current != end_sentinel && (count == DELETE_ALL_OCCURRENCES || removed_count < count)) {
+        Node* next_node = (order == START_FROM_TAIL) ? current->prev : current->next;
+        bool removed = false;
+
+        if (predicate(current->data)) {
+            ListResult result = delete_node_core(list, current, index);
+            if (result == LIST_SUCCESS) {
+                removed_count++;
+                removed = true;
+            }
+        }
+
+        // Going backwards every step lowers the index; going forwards a removal keeps it
+        if (order == START_FROM_TAIL) {
+            index--;
+        } else if (!removed) {
+            index++;
+        }
+
+        current = next_node;
+    }
+
+    return (removed_count > 0) ? LIST_SUCCESS : LIST_ERROR_ELEMENT_NOT_FOUND;
+}
+
+
+// INTERNAL HELPER FUNCTION: true when no node needs individual attention before its memory goes away
+// (pool-backed, no free function to run and no pointer-mode blocks to release).
+static bool can_drop_nodes_in_bulk(const LinkedList* list) {
+    return list->pool && !list->free_node_function && list->pointer_nodes == 0;
+}
+
+// INTERNAL HELPER FUNCTION for releasing every real node without re-linking the list after each one.
+// The caller resets the dummy nodes and the length afterwards.
+static void release_all_nodes(LinkedList* list) {
+
+    if (can_drop_nodes_in_bulk(list)) {
+        // Nothing to visit: hand the whole arena back in O(chunks)
+        pool_reset(list->pool);
+        list->pointer_nodes = 0;
+        return;
+    }
+
+    Node* current = list->head->next;
+    while (current != list->tail) {
+        Node* next_node = current->next;
+
+        if (list->free_node_function && current->mode != LIST_MODE_BORROWED) {
+            list->free_node_function(current->data);
+        }
+        if (current->mode == LIST_MODE_POINTER) {
+            free(current->data);
+        }
+        if (!list->pool && current->mode != LIST_MODE_BORROWED) {
+            free(current);
+        }
+
+        current = next_node;
+    }
+
+    // Pool slots are returned all together, borrowed nodes with their mapping
+    if (list->pool) {
+        pool_reset(list->pool);
+    }
+    list->pointer_nodes = 0;
+    release_file_mapping(list);
+}
+
+/**
+ * @brief Clears all elements from the list (like Python's clear).
+ * @param list The list to clear.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Pool-backed lists without a free function or pointer-mode elements are cleared
+ *       in O(chunks) without visiting the nodes.
+ */
+ListResult clear(LinkedList* list) {
+    
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (is_empty(list)) return LIST_SUCCESS;
+
+    if (list->storage != LIST_STORAGE_NODES) {
+        storage_clear(list);
+        return LIST_SUCCESS;
+    }
+    
+    release_all_nodes(list);
+
+    // Re-link the dummy nodes once
+    list->head->next = list->tail;
+    list->tail->prev = list->head;
+    list->length = 0;
+    note_list_rearranged(list);
+    
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Frees all memory associated with the list.
+ * This includes all nodes and the data within them (using the free_function if provided).
+ * @param list A pointer to the LinkedList to be destroyed.
+ */
+void destroy(LinkedList* list) {
+    
+    if (!list) return;
+
+    // Release the real nodes, unless the pool chunks can simply be dropped below
+    if (!can_drop_nodes_in_bulk(list)) {
+        clear(list);
+    }
+
+    // Free the dummy nodes
+    free(list->head);
+    free(list->tail);
+
+    // Release the node pool together with any nodes still in it
+    pool_destroy(list->pool);
+
+    // Unmap the file of a load_from_file_mmap() list (a no-op once clear() released it)
+    release_file_mapping(list);
+
+    // Release the positional index (its towers never touch the freed nodes)
+    skip_index_destroy(list->skip_index);
+
+    // Release the element buffer of a contiguous list
+    free(list->elements);
+    
+    // Free struct name if allocated
+    if (list->struct_name) {
+        free(list->struct_name);
+    }
+    
+    // Finally, free the list manager itself
+    free(list);
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃             5. Utility Functions              ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+/**
+ * @brief Returns the number of elements in the list.
+ * @param list The list to query.
+ * @return The number of elements.
+ */
+size_t get_length(const LinkedList* list) {
+    return list ? list->length : 0;
+}
+
+/**
+ * @brief Checks if the list is empty.
+ * @param list The list to check.
+ * @return TRUE if the list is empty, FALSE otherwise.
+ */
+bool is_empty(const LinkedList* list) {
+    return !list || list->length == 0;
+}
+
+/**
+ * @brief Prints all elements in the list using default formatting (with indices and newlines).
+ * @param list The list to print.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult print_list(const LinkedList* list) {
+    return print_list_advanced(list, false, true, "\n");
+}
+
+
+/**
+ * @brief Prints all elements in the list with customizable formatting.
+ * @param list The list to print.
+ * @param show_size Whether to show the total size of the list.
+ * @param show_index Whether to show element indices.
+ * @param separator String to print between elements.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult print_list_advanced(const LinkedList* list, bool show_size, bool show_index, const char* separator) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (is_empty(list)) return LIST_ERROR_ELEMENT_NOT_FOUND;
+    if (!list->print_node_function) return LIST_ERROR_NO_PRINT_FUNCTION;
+    
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+
+    if (show_size)
+        printf("List len: %zu\n", list->length);
+
+    size_t index = 0;
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+
+        // Print the separator (if not the first element)
+        if (index > 0)
+            printf("%s", separator);
+
+        // Print the index, if required
+        if (show_index)
+            printf("  [%zu]: ", index);
+
+        // Print the element data itself
+        list->print_node_function(element);
+        index++;
+    }
+
+    // Final newline for clean output
+    printf("\n");
+    
+    return LIST_SUCCESS;
+}
+
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃        6. Search and Access Functions         ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// INTERNAL HELPER FUNCTION called after 'node' was linked in at 'index'
+static void note_node_inserted(LinkedList* list, Node* node, size_t index) {
+
+    list->version++;
+
+    // Everything from 'index' on moved one step towards the tail
+    if (list->finger_node && index <= list->finger_index) {
+        list->finger_index++;
+    }
+
+    if (list->skip_index) {
+        skip_note_inserted(list, node, index);
+    }
+}
+
+// INTERNAL HELPER FUNCTION called before 'node' (at 'index', if known) is unlinked
+static void note_node_removed(LinkedList* list, Node* node, size_t index) {
+
+    list->version++;
+
+    if (list->skip_index) {
+        if (index == LIST_INDEX_UNKNOWN) {
+            skip_invalidate(list->skip_index);
+        } else {
+            skip_note_removed(list, node, index);
+        }
+    }
+
+    if (!list->finger_node) return;
+
+    if (node == list->finger_node) {
+        // Slide the finger onto the successor, which takes over the same index
+        list->finger_node = (node->next != list->tail) ? node->next : NULL;
+    } else if (index == LIST_INDEX_UNKNOWN) {
+        list->finger_node = NULL; // Cannot tell whether the finger's index shifts
+    } else if (index < list->finger_index) {
+        list->finger_index--;
+    }
+}
+
+// INTERNAL HELPER FUNCTION called after nodes were reordered or dropped wholesale (sort, reverse, clear...)
+static void note_order_changed(LinkedList* list) {
+    list->version++;
+    list->finger_node = NULL;
+
+    if (list->skip_index) {
+        skip_invalidate(list->skip_index);
+    }
+}
+
+// INTERNAL HELPER FUNCTION called after a whole-list rearrangement that already cost O(n)
+// (sort, reverse, rotate, clear...): the positional index is rebuilt right away rather than on the
+// next modifying lookup, so get() keeps its O(log n) access.
+static void note_list_rearranged(LinkedList* list) {
+    note_order_changed(list);
+
+    if (list->skip_index) {
+        skip_refresh(list);
+    }
+}
+
+// INTERNAL HELPER FUNCTION taking a consistent copy of the finger (false = none usable).
+// Readers on several threads may move the finger at once (see finger_move()), so the pair is
+// read between two loads of finger_seq and thrown away if a move overlapped it.
+static bool finger_read(const LinkedList* list, Node** out_node, size_t* out_index) {
+
+    size_t seq = __atomic_load_n(&list->finger_seq, __ATOMIC_ACQUIRE);
+    if (seq & 1) return false; // A move is in progress
+
+    // Acquire loads keep the second check of finger_seq behind them
+    *out_node = __atomic_load_n(&list->finger_node, __ATOMIC_ACQUIRE);
+    *out_index = __atomic_load_n(&list->finger_index, __ATOMIC_ACQUIRE);
+
+    return *out_node && __atomic_load_n(&list->finger_seq, __ATOMIC_RELAXED) == seq;
+}
+
+// INTERNAL HELPER FUNCTION leaving the finger on 'node' (at 'index') after a lookup and counting
+// the lookup for list_finger_stats(). get() calls this through a const list, so it must tolerate
+// concurrent readers: a thread that finds another one mid-move skips the update (the finger is only
+// a hint), and the counters are bumped atomically. Structural changes never run alongside readers
+// and update the fields directly.
+static void finger_move(const LinkedList* list, Node* node, size_t index, bool hit) {
+
+    LinkedList* shared = (LinkedList*)list; // The finger is a cache, not part of the list's value
+
+    __atomic_fetch_add(&shared->finger_lookups, 1, __ATOMIC_RELAXED);
+    if (hit) __atomic_fetch_add(&shared->finger_hits, 1, __ATOMIC_RELAXED);
+
+    size_t seq = __atomic_load_n(&shared->finger_seq, __ATOMIC_RELAXED);
+    if ((seq & 1) || !__atomic_compare_exchange_n(&shared->finger_seq, &seq, seq + 1, false,
+                                                  __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        return; // Another reader is moving it
+    }
+
+    // Release stores: a reader that sees either new field also sees the odd finger_seq
+    __atomic_store_n(&shared->finger_node, node, __ATOMIC_RELEASE);
+    __atomic_store_n(&shared->finger_index, index, __ATOMIC_RELEASE);
+    __atomic_store_n(&shared->finger_seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+// INTERNAL HELPER FUNCTION for finding node by index.
+// Walks from whichever of head, tail or the finger (last looked-up position) is closest, and
+// leaves the finger on the result so sequential index loops cost O(1) per call.
+// In indexed mode, positions far from all three are found through the skip list instead.
+// 'cache' is the list itself when the caller may modify it, which lets a dirty skip index be
+// rebuilt first; read-only callers pass NULL.
+static Node* find_node_by_index(const LinkedList* list, size_t index, LinkedList* cache) {
+    
+    if (!list || index >= list->length) return NULL;
+
+    size_t from_head = index;
+    size_t from_tail = list->length - 1 - index;
+    size_t from_finger = (size_t)-1;
+    Node* finger;
+    size_t finger_index;
+    if (finger_read(list, &finger, &finger_index)) {
+        from_finger = (index >= finger_index) ? index - finger_index : finger_index - index;
+    }
+    
+    Node* current = NULL;
+    bool hit = false;
+
+    size_t nearest = from_finger < from_head ? from_finger : from_head;
+    if (from_tail < nearest) nearest = from_tail;
+
+    // A dirty skip index is rebuilt only for callers allowed to modify the list; readers walk
+    if (cache && cache->skip_index && nearest > SKIP_WALK_LIMIT) skip_refresh(cache);
+
+    if (list->skip_index && nearest > SKIP_WALK_LIMIT && (current = skip_lookup(list, index))) {
+        // Far from every known position - found by descending the positional index
+    } else if (from_finger < from_head && from_finger < from_tail) {
+        // Closest to the finger - walk from there in the needed direction
+        hit = true;
+        current = finger;
+        for (size_t i = finger_index; i < index; i++) {
+            current = current->next;
+        }
+        for (size_t i = finger_index; i > index; i--) {
+            current = current->prev;
+        }
+    } else if (from_head <= from_tail) {
+        // Index is in first half - traverse forward from head
+        current = list->head->next;
+        for (size_t i = 0; i < index; i++) {
+            current = current->next;
+        }
+    } else {
+        // Index is in second half - traverse backward from tail
+        current = list->tail->prev;
+        for (size_t i = list->length - 1; i > index; i--) {
+            current = current->prev;
+        }
+    }
+
+    finger_move(list, current, index, hit);
+    return current;
+}
+
+/**
+ * @brief Reports how often index lookups could start from the cached finger.
+ * @param list The list to query.
+ * @param out_stats Receives the counters.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Lookups are made by get(), set_field/set_node, delete_index and the insert_index functions.
+ */
+ListResult list_finger_stats(const LinkedList* list, ListFingerStats* out_stats) {
+    if (!list || !out_stats) return LIST_ERROR_NULL_POINTER;
+
+    // get() may be counting on other threads
+    out_stats->lookups = __atomic_load_n(&list->finger_lookups, __ATOMIC_RELAXED);
+    out_stats->finger_hits = __atomic_load_n(&list->finger_hits, __ATOMIC_RELAXED);
+    out_stats->hit_rate = out_stats->lookups ? (double)out_stats->finger_hits / (double)out_stats->lookups : 0.0;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Resets the counters reported by list_finger_stats().
+ * @param list The list to reset.
+ */
+void list_reset_finger_stats(LinkedList* list) {
+    if (!list) return;
+    list->finger_lookups = 0;
+    list->finger_hits = 0;
+}
+
+/**
+ * @brief Gets a pointer to an element at a specific index (direct access without copying).
+ * @param list The list to get from.
+ * @param index The index to get.
+ * @return Pointer to the data at the specified index, or NULL on failure.
+ * @warning The returned pointer is valid only as long as the list structure remains unchanged.
+ */
+void* get(const LinkedList* list, size_t index) {
+    
+    if (!list || index >= list->length) return NULL;
+    
+    // Moves the finger, so loops over neighbouring indices cost O(1) per call. The move is
+    // race-tolerant, so several threads may still call get() on the same list at once.
+    return element_at(list, index, NULL);
+}
+
+/**
+ * @brief Returns the index of the first element that satisfies the predicate.
+ * @param list The list to search in.
+ * @param predicate The function to test each element.
+ * @param arg An optional argument to pass to the predicate.
+ * @return The index if found, or a negative error code.
+ */
+int index_of(const LinkedList* list, PredicateFunction predicate) {
+    return index_of_advanced(list, START_FROM_HEAD, predicate);
+}
+
+/**
+ * @brief Returns the index of the first or last element that satisfies the predicate.
+ * @param list The list to search in.
+ * @param direction START_FROM_HEAD or START_FROM_TAIL.
+ * @param predicate The function to test each element.
+ * @return The index if found, or a negative error code.
+ */
+int index_of_advanced(const LinkedList* list, Direction order, PredicateFunction predicate) {
+    if (!list) return -LIST_ERROR_NULL_POINTER;
+    if (!predicate) return -LIST_ERROR_INVALID_OPERATION;
+
+    ElementWalk walk;
+    walk_list(&walk, list, order);
+
+    // Walking backwards the first element seen is the last one
+    size_t index = (order == START_FROM_TAIL) ? list->length - 1 : 0;
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        if (predicate(element)) {
+            return (int)index;
+        }
+        if (order == START_FROM_TAIL) {
+            index--;
+        } else {
+            index++;
+        }
+    }
+    return -LIST_ERROR_ELEMENT_NOT_FOUND; // Element not found
+}
+
+// INTERNAL HELPER FUNCTION counting the matches among the elements of a walk
+static size_t count_matching_walk(ElementWalk* walk, PredicateFunction predicate) {
+
+    size_t count = 0;
+    for (void* element = walk_next(walk); element; element = walk_next(walk)) {
+        if (predicate(element)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Counts how many elements in the list satisfy a given condition.
+ * @param list The list to iterate over.
+ * @param predicate A function pointer that returns true if an element satisfies the condition.
+ * @param arg An optional argument to pass to the predicate function.
+ * @return The number of elements that satisfy the condition.
+ */
+size_t count_matching(const LinkedList* list, PredicateFunction predicate) {
+    if (!list || !predicate) return 0;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    return count_matching_walk(&walk, predicate);
+}
+
+
+/**
+ * @brief Sets a field value by copying data directly (no memory management).
+ * @param list The list containing the element.
+ * @param index The index of the element to modify.
+ * @param field_offset The byte offset of the field within the struct.
+ * @param field_size The size of the field in bytes.
+ * @param new_value Pointer to the new value to set.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Use this for primitive types and when you manage memory yourself.
+ */
+ListResult set_field_impl(LinkedList* list, size_t index, size_t field_offset, size_t field_size, const void* new_value) {
+    return set_field_advanced_impl(list, index, field_offset, field_size, new_value, false, false, 0);
+}
+
+/**
+ * @brief Sets a dynamically allocated field with proper memory management.
+ * @param list The list containing the element.
+ * @param index The index of the element to modify.
+ * @param field_offset The byte offset of the pointer field within the struct.
+ * @param data_size The size of the data to allocate and copy.
+ * @param new_data Pointer to the new data to copy.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note This frees old memory, allocates new memory, and copies the data.
+ */
+ListResult set_allocated_field_impl(LinkedList* list, size_t index, size_t field_offset, size_t data_size, const void* new_data) {
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    if (field_offset + sizeof(void*) > list->element_size) return LIST_ERROR_INVALID_OPERATION;
+
+    void* element = element_at(list, index, list);
+    if (!element) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    
+    // Calculate the address of the pointer field
+    void** ptr_field = (void**)((char*)element + field_offset);
+    
+    // Free old memory if it exists
+    if (*ptr_field) {
+        free(*ptr_field);
+    }
+    
+    // Allocate and copy new data
+    if (new_data && data_size > 0) {
+        *ptr_field = malloc(data_size);
+        if (*ptr_field) {
+            memcpy(*ptr_field, new_data, data_size);
+        } else {
+            return LIST_ERROR_MEMORY_ALLOC;
+        }
+    } else {
+        *ptr_field = NULL;
+    }
+    
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Sets a field with advanced memory management control.
+ * @param list The list containing the element.
+ * @param index The index of the element to modify.
+ * @param field_offset The byte offset of the field within the struct.
+ * @param field_size The size of the field in bytes.
+ * @param new_value Pointer to the new value or data.
+ * @param should_free_old Whether to free existing memory (for pointer fields).
+ * @param should_alloc_new Whether to allocate new memory and copy data.
+ * @param data_size Size of data to allocate (when should_alloc_new is true).
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult set_field_advanced_impl(LinkedList* list, size_t index, size_t field_offset, size_t field_size, 
+                                   const void* new_value, bool should_free_old, bool should_alloc_new, size_t data_size) {
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    if (field_offset + field_size > list->element_size) return LIST_ERROR_INVALID_OPERATION;
+
+    void* element = element_at(list, index, list);
+    if (!element) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    
+    // Handle different memory management modes
+    if (field_size == sizeof(void*) && (should_free_old || should_alloc_new)) {
+        // This is likely a pointer field with memory management
+        void** ptr_field = (void**)((char*)element + field_offset);
+        
+        // Free old memory if requested
+        if (should_free_old && *ptr_field) {
+            free(*ptr_field);
+            *ptr_field = NULL;
+        }
+        
+        // Set new value based on allocation mode
+        if (should_alloc_new && new_value && data_size > 0) {
+            // Allocate new memory and copy data
+            *ptr_field = malloc(data_size);
+            if (!*ptr_field) return LIST_ERROR_MEMORY_ALLOC;
+            memcpy(*ptr_field, new_value, data_size);
+        } else if (new_value) {
+            // Just store the provided pointer (could be NULL)
+            // Cast away const since we're storing it as void*
+            *ptr_field = (void*)(uintptr_t)new_value;
+        } else {
+            // Set to NULL
+            *ptr_field = NULL;
+        }
+    } else {
+        // Simple field assignment using memcpy (equivalent to set_field_impl)
+        if (new_value) {
+            char* field_ptr = (char*)element + field_offset;
+            memcpy(field_ptr, new_value, field_size);
+        }
+    }
+    
+    return LIST_SUCCESS;
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃             6B. Node Setting Functions        ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+/**
+ * @brief Replaces an entire element by value at the specified index.
+ * @param list The list to modify.
+ * @param index The index of the element to replace.
+ * @param new_value Pointer to the new value to copy into place.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * 
+ * This function directly replaces the data in the existing node instead of deleting and inserting.
+ * This is more efficient and avoids memory management issues.
+ */
+ListResult set_node_value_impl(LinkedList* list, size_t index, const void* new_value) {
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!new_value) return LIST_ERROR_NULL_POINTER;
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    
+    Node* node = list->storage == LIST_STORAGE_NODES ? find_node_by_index(list, index, list) : NULL;
+    void* element = node ? node->data : element_at(list, index, list);
+    if (!element) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    
+    // Free the old data if there's a free function (borrowed elements live in a file mapping,
+    // so anything they point to was never allocated by this process)
+    if (list->free_node_function && !(node && node->mode == LIST_MODE_BORROWED)) {
+        list->free_node_function(element);
+    }
+    
+    // Copy the new data into the existing node
+    memcpy(element, new_value, list->element_size);
+    
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Replaces an entire element by pointer at the specified index.
+ * @param list The list to modify.
+ * @param index The index of the element to replace.
+ * @param new_value_ptr Pointer to the new element (ownership transfers to list).
+ * @return LIST_SUCCESS on success, error code on failure.
+ * 
+ * This function directly replaces the data in the existing node with the provided pointer data.
+ */
+ListResult set_node_ptr_impl(LinkedList* list, size_t index, void* new_value_ptr) {
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!new_value_ptr) return LIST_ERROR_NULL_POINTER;
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    
+    Node* node = list->storage == LIST_STORAGE_NODES ? find_node_by_index(list, index, list) : NULL;
+    void* element = node ? node->data : element_at(list, index, list);
+    if (!element) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    
+    // Free the old data if there's a free function (borrowed elements live in a file mapping,
+    // so anything they point to was never allocated by this process)
+    if (list->free_node_function && !(node && node->mode == LIST_MODE_BORROWED)) {
+        list->free_node_function(element);
+    }
+    
+    // Copy the new data from the pointer into the existing node
+    memcpy(element, new_value_ptr, list->element_size);
+    
+    // Free the provided pointer since we copied its contents
+    free(new_value_ptr);
+    
+    return LIST_SUCCESS;
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃             6C. Cursor Functions              ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// INTERNAL HELPER FUNCTION for a cursor that never becomes valid (lists without one node per element)
+static ListCursor inert_cursor(LinkedList* list, Direction direction) {
+    ListCursor cursor = { list, list->tail, 0, direction, list->tail, list->tail, true };
+    return cursor;
+}
+
+/**
+ * @brief Creates a forward cursor positioned on the first element.
+ * @param list The list to traverse.
+ * @return The cursor (not valid if the list is empty or NULL).
+ */
+ListCursor cursor_begin(LinkedList* list) {
+    if (list && list->storage != LIST_STORAGE_NODES) return inert_cursor(list, START_FROM_HEAD);
+    ListCursor cursor = { list, list ? list->head->next : NULL, 0, START_FROM_HEAD,
+                          list ? list->head : NULL, list ? list->tail : NULL, false };
+    return cursor;
+}
+
+/**
+ * @brief Creates a reverse cursor positioned on the last element.
+ * @param list The list to traverse.
+ * @return The cursor (not valid if the list is empty or NULL).
+ */
+ListCursor cursor_rbegin(LinkedList* list) {
+    if (list && list->storage != LIST_STORAGE_NODES) return inert_cursor(list, START_FROM_TAIL);
+    ListCursor cursor = { list, list ? list->tail->prev : NULL, list ? list->length - 1 : 0, START_FROM_TAIL,
+                          list ? list->head : NULL, list ? list->tail : NULL, false };
+    return cursor;
+}
+
+/**
+ * @brief Checks whether the cursor is on an element (and not past either end).
+ * @param cursor The cursor to check.
+ * @return true if cursor_peek() would return an element.
+ */
+bool cursor_valid(const ListCursor* cursor) {
+    return cursor && cursor->list && cursor->node &&
+           cursor->node != cursor->before_first && cursor->node != cursor->after_last;
+}
+
+/**
+ * @brief Returns the element under the cursor (direct access without copying).
+ * @param cursor The cursor.
+ * @return Pointer to the element's data, or NULL if the cursor is not on an element.
+ */
+void* cursor_peek(const ListCursor* cursor) {
+    return cursor_valid(cursor) ? cursor->node->data : NULL;
+}
+
+/**
+ * @brief Returns the index of the element under the cursor.
+ * @param cursor The cursor.
+ * @return The 0-based index (only meaningful while cursor_valid() is true).
+ */
+size_t cursor_index(const ListCursor* cursor) {
+    return cursor ? cursor->index : 0;
+}
+
+/**
+ * @brief Moves the cursor one step in its own direction (towards the tail for forward cursors).
+ * @param cursor The cursor to move.
+ * @return true if the cursor is on an element after moving.
+ */
+bool cursor_next(ListCursor* cursor) {
+    if (!cursor_valid(cursor)) return false;
+
+    if (cursor->direction == START_FROM_TAIL) {
+        cursor->node = cursor->node->prev;
+        cursor->index--;
+    } else {
+        cursor->node = cursor->node->next;
+        cursor->index++;
+    }
+    return cursor_valid(cursor);
+}
+
+/**
+ * @brief Moves the cursor one step against its direction (towards the head for forward cursors).
+ * @param cursor The cursor to move. A cursor that ran off the end can step back onto the list.
+ * @return true if the cursor is on an element after moving.
+ */
+bool cursor_prev(ListCursor* cursor) {
+    if (!cursor || !cursor->list || !cursor->node) return false;
+
+    if (cursor->direction == START_FROM_TAIL) {
+        if (cursor->node == cursor->after_last) return false;
+        cursor->node = cursor->node->next;
+        cursor->index++;
+    } else {
+        if (cursor->node == cursor->before_first) return false;
+        cursor->node = cursor->node->prev;
+        cursor->index--;
+    }
+    return cursor_valid(cursor);
+}
+
+// INTERNAL HELPER FUNCTION shared by the cursor insertions. 'after' is in list order
+// (towards the tail), independent of the cursor's direction.
+static ListResult cursor_insert_generic(ListCursor* cursor, void* data, ListMemoryMode mode, bool after) {
+
+    if (!cursor || !cursor->list || !cursor->node) return LIST_ERROR_NULL_POINTER;
+    if (cursor->read_only) return LIST_ERROR_INVALID_OPERATION;
+    LinkedList* list = cursor->list;
+    if (list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION;
+
+    // Inserting after the dummy tail or before the dummy head has no meaning
+    if ((after && cursor->node == list->tail) || (!after && cursor->node == list->head)) {
+        return LIST_ERROR_INVALID_OPERATION;
+    }
+
+    // A full DELETE_OLD_WHEN_FULL list evicts its oldest element, which must not be the cursor's
+    bool evicts = list->max_size != UNLIMITED && list->length >= list->max_size &&
+                  list->allow_overwrite == DELETE_OLD_WHEN_FULL;
+    if (evicts && cursor->node == list->head->next) return LIST_ERROR_INVALID_OPERATION;
+
+    Node* new_node;
+    ListResult result = insert_node_core_generic(list, data, mode, &new_node);
+    if (result != LIST_SUCCESS) return result;
+
+    // The evicted element sat in front of the cursor
+    if (evicts && cursor->node != list->head) cursor->index--;
+
+    if (after) {
+        link_node_before(list, new_node, cursor->node->next, cursor->index + 1);
+    } else {
+        link_node_before(list, new_node, cursor->node, cursor->index);
+        cursor->index++; // The cursor's element moved one position towards the tail
+    }
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Inserts a copy of 'data' in front of the cursor's element (towards the head).
+ * @param cursor The cursor. It keeps pointing at the same element.
+ * @param data The data to copy into the list.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note On a forward cursor that ran off the end this appends to the list.
+ */
+ListResult cursor_insert_before(ListCursor* cursor, void* data) {
+    return cursor_insert_generic(cursor, data, LIST_MODE_VALUE, false);
+}
+
+/**
+ * @brief Inserts a copy of 'data' behind the cursor's element (towards the tail).
+ * @param cursor The cursor. It keeps pointing at the same element.
+ * @param data The data to copy into the list.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note On a reverse cursor that ran off the front this prepends to the list.
+ */
+ListResult cursor_insert_after(ListCursor* cursor, void* data) {
+    return cursor_insert_generic(cursor, data, LIST_MODE_VALUE, true);
+}
+
+/**
+ * @brief Pointer-mode version of cursor_insert_before() (ownership of data_ptr transfers to the list).
+ */
+ListResult cursor_insert_before_ptr(ListCursor* cursor, void* data_ptr) {
+    return cursor_insert_generic(cursor, data_ptr, LIST_MODE_POINTER, false);
+}
+
+/**
+ * @brief Pointer-mode version of cursor_insert_after() (ownership of data_ptr transfers to the list).
+ */
+ListResult cursor_insert_after_ptr(ListCursor* cursor, void* data_ptr) {
+    return cursor_insert_generic(cursor, data_ptr, LIST_MODE_POINTER, true);
+}
+
+/**
+ * @brief Deletes the element under the cursor and moves to the next one in the cursor's direction.
+ * @param cursor The cursor.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult cursor_erase(ListCursor* cursor) {
+    if (!cursor || !cursor->list) return LIST_ERROR_NULL_POINTER;
+    if (cursor->read_only || !cursor_valid(cursor)) return LIST_ERROR_INVALID_OPERATION;
+
+    Node* doomed = cursor->node;
+    size_t doomed_index = cursor->index;
+    if (cursor->direction == START_FROM_TAIL) {
+        cursor->node = doomed->prev;
+        cursor->index--;
+    } else {
+        cursor->node = doomed->next; // Takes over the erased element's index
+    }
+
+    return delete_node_core(cursor->list, doomed, doomed_index);
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃            6D. Positional Index               ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// Indexed mode keeps an indexable skip list on top of the node chain. The chain itself is
+// the bottom lane; about a quarter of the nodes also carry a "tower" of express links, and
+// every link records how many positions it jumps (its span). A position is found by adding
+// up spans from the top lane down, then walking the last few nodes of the chain.
+// Positions here count from 1, with the dummy head (where the header tower stands) at 0.
+
+#define SKIP_MAX_LEVEL 16   // Each lane is 4x sparser, so 16 lanes cover 4^16 elements
+
+typedef struct SkipTower SkipTower;
+
+typedef struct {
+    SkipTower* next;        // Next tower on this lane (NULL = the lane runs to the end)
+    size_t span;            // Positions jumped (up to length + 1 when next is NULL)
+} SkipLink;
+
+struct SkipTower {
+    Node* node;             // Node the tower stands on (the dummy head for the header)
+    int height;             // Number of lanes the tower reaches
+    SkipLink links[];       // links[0] is the lowest express lane
+};
+
+struct SkipIndex {
+    SkipTower* header;      // Full-height tower on the dummy head
+    int levels;             // Lanes currently in use
+    bool dirty;             // Towers were dropped - rebuilt by the next modifying lookup
+    size_t towers;          // Towers, not counting the header
+    size_t bytes;           // Heap memory held by the index
+    unsigned int random_state; // xorshift state for tower heights
+};
+
+// INTERNAL HELPER FUNCTION for picking a tower height (0 = no tower, each extra lane 1/4 as likely)
+static int skip_random_height(struct SkipIndex* index) {
+
+    unsigned int x = index->random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    index->random_state = x;
+
+    int height = 0;
+    while (height < SKIP_MAX_LEVEL && (x & 3) == 0) {
+        height++;
+        x >>= 2;
+    }
+    return height;
+}
+
+// INTERNAL HELPER FUNCTION for allocating a tower on 'node'
+static SkipTower* skip_new_tower(struct SkipIndex* index, Node* node, int height) {
+
+    size_t size = sizeof(SkipTower) + (size_t)height * sizeof(SkipLink);
+    SkipTower* tower = malloc(size);
+    if (!tower) return NULL;
+
+    tower->node = node;
+    tower->height = height;
+    index->towers++;
+    index->bytes += size;
+    return tower;
+}
+
+// INTERNAL HELPER FUNCTION for freeing a tower
+static void skip_free_tower(struct SkipIndex* index, SkipTower* tower) {
+    index->towers--;
+    index->bytes -= sizeof(SkipTower) + (size_t)tower->height * sizeof(SkipLink);
+    free(tower);
+}
+
+// INTERNAL HELPER FUNCTION for dropping every tower; the next modifying lookup rebuilds them.
+// Only the towers are touched, so this is safe after the nodes are gone.
+static void skip_invalidate(struct SkipIndex* index) {
+
+    if (index->dirty) return;
+
+    SkipTower* header = index->header;
+    SkipTower* tower = index->levels > 0 ? header->links[0].next : NULL;
+    while (tower) {
+        SkipTower* next = tower->links[0].next;
+        skip_free_tower(index, tower);
+        tower = next;
+    }
+
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++) {
+        header->links[i].next = NULL;
+        header->links[i].span = 0;
+    }
+    index->levels = 0;
+    index->dirty = true;
+}
+
+// INTERNAL HELPER FUNCTION for building every tower from the node chain (O(n)).
+// Returns false if memory ran out; the index then stays dirty and lookups fall back to walking.
+static bool skip_rebuild(LinkedList* list) {
+
+    struct SkipIndex* index = list->skip_index;
+    skip_invalidate(index);
+
+    // Last tower seen on each lane, and its position
+    SkipTower* last[SKIP_MAX_LEVEL];
+    size_t last_rank[SKIP_MAX_LEVEL];
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++) {
+        last[i] = index->header;
+        last_rank[i] = 0;
+    }
+
+    size_t rank = 0;
+    int levels = 0;
+    for (Node* node = list->head->next; node != list->tail; node = node->next) {
+        rank++;
+        int height = skip_random_height(index);
+        if (height == 0) continue;
+
+        SkipTower* tower = skip_new_tower(index, node, height);
+        if (!tower) {
+            // Terminate the lanes built so far so the towers can be walked and freed
+            for (int i = 0; i < levels; i++) last[i]->links[i].next = NULL;
+            index->levels = levels;
+            index->dirty = false;
+            skip_invalidate(index);
+            return false;
+        }
+
+        for (int i = 0; i < height; i++) {
+            last[i]->links[i].next = tower;
+            last[i]->links[i].span = rank - last_rank[i];
+            last[i] = tower;
+            last_rank[i] = rank;
+        }
+        if (height > levels) levels = height;
+    }
+
+    // Close every lane at the end of the list
+    for (int i = 0; i < levels; i++) {
+        last[i]->links[i].next = NULL;
+        last[i]->links[i].span = rank + 1 - last_rank[i];
+    }
+
+    index->levels = levels;
+    index->dirty = false;
+    return true;
+}
+
+// INTERNAL HELPER FUNCTION rebuilding the index after it was dropped (splices, removals at unknown
+// positions, or a rebuild that ran out of memory).
+// Writes to the list, so only paths that may modify it call this.
+static void skip_refresh(LinkedList* list) {
+    if (list->skip_index->dirty) skip_rebuild(list);
+}
+
+// INTERNAL HELPER FUNCTION for finding the node at 'index' in O(log n).
+// Only reads the index: returns NULL while it is dirty, so the caller walks instead.
+static Node* skip_lookup(const LinkedList* list, size_t index) {
+
+    const struct SkipIndex* skip = list->skip_index;
+    if (skip->dirty) return NULL;
+
+    size_t target = index + 1;
+    size_t rank = 0;
+    SkipTower* tower = skip->header;
+
+    for (int i = skip->levels - 1; i >= 0; i--) {
+        while (tower->links[i].next && rank + tower->links[i].span <= target) {
+            rank += tower->links[i].span;
+            tower = tower->links[i].next;
+        }
+    }
+
+    // Finish along the chain (a few nodes on average)
+    Node* current = tower->node;
+    for (; rank < target; rank++) {
+        current = current->next;
+    }
+    return current;
+}
+
+// INTERNAL HELPER FUNCTION called after 'node' was linked in at 'index' (list->length already counts it)
+static void skip_note_inserted(LinkedList* list, Node* node, size_t index) {
+
+    struct SkipIndex* skip = list->skip_index;
+    if (skip->dirty) return;
+
+    size_t target = index + 1;
+
+    // On each lane, find the last tower in front of the new position
+    SkipTower* update[SKIP_MAX_LEVEL];
+    size_t rank[SKIP_MAX_LEVEL];
+    SkipTower* tower = skip->header;
+    size_t position = 0;
+    for (int i = skip->levels - 1; i >= 0; i--) {
+        while (tower->links[i].next && position + tower->links[i].span < target) {
+            position += tower->links[i].span;
+            tower = tower->links[i].next;
+        }
+        update[i] = tower;
+        rank[i] = position;
+    }
+
+    // Give the node a tower (a failed allocation just means no tower - still correct)
+    int height = skip_random_height(skip);
+    SkipTower* new_tower = height > 0 ? skip_new_tower(skip, node, height) : NULL;
+    if (!new_tower) height = 0;
+
+    // New lanes start out as one link from the header to the end of the (old) list
+    for (int i = skip->levels; i < height; i++) {
+        update[i] = skip->header;
+        rank[i] = 0;
+        skip->header->links[i].next = NULL;
+        skip->header->links[i].span = list->length;
+    }
+    if (height > skip->levels) skip->levels = height;
+
+    // Split the links the tower cuts through, and widen the ones that pass over it
+    for (int i = 0; i < height; i++) {
+        SkipLink* link = &update[i]->links[i];
+        new_tower->links[i].next = link->next;
+        new_tower->links[i].span = link->span - (target - rank[i]) + 1;
+        link->next = new_tower;
+        link->span = target - rank[i];
+    }
+    for (int i = height; i < skip->levels; i++) {
+        update[i]->links[i].span++;
+    }
+}
+
+// INTERNAL HELPER FUNCTION called before 'node' (at 'index') is unlinked
+static void skip_note_removed(LinkedList* list, Node* node, size_t index) {
+
+    struct SkipIndex* skip = list->skip_index;
+    if (skip->dirty) return;
+
+    size_t target = index + 1;
+    SkipTower* doomed = NULL;
+    SkipTower* tower = skip->header;
+    size_t position = 0;
+
+    for (int i = skip->levels - 1; i >= 0; i--) {
+        while (tower->links[i].next && position + tower->links[i].span < target) {
+            position += tower->links[i].span;
+            tower = tower->links[i].next;
+        }
+
+        SkipLink* link = &tower->links[i];
+        if (link->next && link->next->node == node) {
+            // Unlink the node's own tower from this lane
+            doomed = link->next;
+            link->span += doomed->links[i].span - 1;
+            link->next = doomed->links[i].next;
+        } else {
+            link->span--;
+        }
+    }
+
+    if (doomed) skip_free_tower(skip, doomed);
+
+    // Retire lanes that became empty
+    while (skip->levels > 0 && !skip->header->links[skip->levels - 1].next) {
+        skip->levels--;
+    }
+}
+
+// INTERNAL HELPER FUNCTION for freeing the index
+static void skip_index_destroy(struct SkipIndex* index) {
+    if (!index) return;
+    skip_invalidate(index);
+    free(index->header);
+    free(index);
+}
+
+/**
+ * @brief Switches the list to indexed mode: get, set_field/set_node, delete_index and the
+ * insert_index functions become O(log n) instead of walking up to n/2 nodes.
+ * @param list The list to index.
+ * @return LIST_SUCCESS on success (also if already indexed), error code on failure.
+ * @note Costs about 10 bytes per element plus O(log n) extra work for every insert and delete.
+ * Sorting, reversing, rotating and clearing rebuild the index as they go (O(n), like those
+ * operations). Splices drop it until the next set_field/set_node, delete_index or insert_index
+ * call; get() walks until then, as it never rebuilds the index.
+ */
+ListResult list_enable_index(LinkedList* list) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION; // get() is already O(1)
+    if (list->skip_index) return LIST_SUCCESS;
+
+    struct SkipIndex* index = malloc(sizeof(struct SkipIndex));
+    if (!index) return LIST_ERROR_MEMORY_ALLOC;
+
+    size_t header_size = sizeof(SkipTower) + SKIP_MAX_LEVEL * sizeof(SkipLink);
+    index->header = malloc(header_size);
+    if (!index->header) {
+        free(index);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    index->header->node = list->head;
+    index->header->height = SKIP_MAX_LEVEL;
+    index->levels = 0;
+    index->dirty = false;
+    index->towers = 0;
+    index->bytes = sizeof(struct SkipIndex) + header_size;
+    index->random_state = 2463534242u;
+    skip_invalidate(index);  // Marks it dirty and clears the header lanes
+
+    list->skip_index = index;
+    if (!skip_rebuild(list)) {
+        list->skip_index = NULL;
+        skip_index_destroy(index);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Leaves indexed mode and frees the index.
+ * @param list The list to change.
+ * @return LIST_SUCCESS on success (also if the list was not indexed), error code on failure.
+ */
+ListResult list_disable_index(LinkedList* list) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+
+    skip_index_destroy(list->skip_index);
+    list->skip_index = NULL;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Reports the memory overhead of the positional index.
+ * @param list The list to query.
+ * @param out_stats Receives the numbers (all zero if the list is not indexed).
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note After a sort/reverse/rotate/clear the towers are only rebuilt on the next positional
+ * lookup, so until then the report shows the index without them.
+ */
+ListResult list_index_stats(const LinkedList* list, ListIndexStats* out_stats) {
+
+    if (!list || !out_stats) return LIST_ERROR_NULL_POINTER;
+
+    memset(out_stats, 0, sizeof(*out_stats));
+    const struct SkipIndex* index = list->skip_index;
+    if (!index) return LIST_SUCCESS;
+
+    out_stats->enabled = true;
+    out_stats->levels = (size_t)index->levels;
+    out_stats->towers = index->towers;
+    out_stats->bytes = index->bytes;
+    out_stats->bytes_per_element = list->length ? (double)index->bytes / (double)list->length : 0.0;
+    return LIST_SUCCESS;
+}
+
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃             7. Sorting Functions              ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// INTERNAL HELPER FUNCTION for merging two sorted NULL-terminated chains (linked through 'next' only).
+// On equal elements the node from 'left' goes first, which keeps the merge stable.
+static Node* merge_node_chains(Node* left, Node* right, CompareFunction compare_fn) {
+
+    Node* merged = NULL;
+    Node** link = &merged;
+
+    while (left && right) {
+        if (compare_fn(right->data, left->data) < 0) {
+            *link = right;
+            right = right->next;
+        } else {
+            *link = left;
+            left = left->next;
+        }
+        link = &(*link)->next;
+    }
+    *link = left ? left : right;
+
+    return merged;
+}
+
+// INTERNAL HELPER FUNCTION for sorting a NULL-terminated chain (linked through 'next' only).
+// Bottom-up merge sort: bins[i] holds a sorted run of 2^i nodes, merged like a binary counter.
+// Older runs always sit on the left of a merge, so the sort is stable. No allocation is done.
+static Node* merge_sort_chain(Node* first, CompareFunction compare_fn) {
+
+    Node* bins[64] = { NULL };
+    size_t used_bins = 0;
+
+    while (first) {
+        Node* carry = first;
+        first = first->next;
+        carry->next = NULL;
+
+        size_t i = 0;
+        while (i < used_bins && bins[i]) {
+            carry = merge_node_chains(bins[i], carry, compare_fn);
+            bins[i] = NULL;
+            i++;
+        }
+        bins[i] = carry;
+        if (i == used_bins) used_bins++;
+    }
+
+    // Fold the remaining runs; higher bins hold earlier elements
+    Node* sorted = NULL;
+    for (size_t i = 0; i < used_bins; i++) {
+        if (bins[i]) {
+            sorted = sorted ? merge_node_chains(bins[i], sorted, compare_fn) : bins[i];
+        }
+    }
+
+    return sorted;
+}
+
+// INTERNAL HELPER FUNCTION for re-attaching a NULL-terminated chain between the dummy nodes.
+// Rebuilds every 'prev' pointer, so callers only need to keep 'next' consistent.
+static void attach_chain(LinkedList* list, Node* first) {
+
+    Node* prev_node = list->head;
+    Node* current = first;
+
+    while (current) {
+        prev_node->next = current;
+        current->prev = prev_node;
+        prev_node = current;
+        current = current->next;
+    }
+
+    prev_node->next = list->tail;
+    list->tail->prev = prev_node;
+}
+
+/**
+ * @brief Sorts the list in place (ascending order).
+ * @param list The list to sort.
+ * @param compare_fn Comparison function.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Stable O(n log n) merge sort. Nodes are relinked rather than copied, so
+ *       pointers previously returned by get() keep pointing at the same element.
+ */
+ListResult sort_list(LinkedList* list, CompareFunction compare_fn) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!compare_fn) return LIST_ERROR_NO_COMPARE_FUNCTION;
+    if (list->length <= 1) return LIST_SUCCESS;
+    if (list->storage != LIST_STORAGE_NODES) return storage_sort(list, compare_fn);
+    
+    // Detach the real nodes from the dummy tail so the chain is NULL-terminated
+    Node* first = list->head->next;
+    list->tail->prev->next = NULL;
+
+    Node* sorted = merge_sort_chain(first, compare_fn);
+
+    // Restore prev pointers and the dummy head/tail links
+    attach_chain(list, sorted);
+    note_list_rearranged(list);
+    
+    return LIST_SUCCESS;
+}
+
+// Radix sort: every element is paired with its key, mapped to an unsigned integer whose order is
+// the key's order (signed keys get their sign bit flipped). The pairs are then sorted by LSD radix
+// sort, one byte per pass; each pass is a stable counting sort, so the whole sort is stable.
+
+typedef struct {
+    uint64_t key;
+    void* item;   // Node (node storage) or element (array-like storage)
+} RadixItem;
+
+// INTERNAL HELPER FUNCTION reading the 'width'-byte key at the start of 'key_address' as an unsigned value
+static inline uint64_t radix_key(const unsigned char* key_address, size_t width, bool is_signed) {
+
+    uint64_t key;
+    switch (width) {
+        case 1: { uint8_t v; memcpy(&v, key_address, 1); key = v; break; }
+        case 2: { uint16_t v; memcpy(&v, key_address, 2); key = v; break; }
+        case 4: { uint32_t v; memcpy(&v, key_address, 4); key = v; break; }
+        default: { uint64_t v; memcpy(&v, key_address, 8); key = v; break; }
+    }
+    // Flipping the sign bit puts negative values before positive ones
+    return is_signed ? key ^ ((uint64_t)1 << (width * 8 - 1)) : key;
+}
+
+// INTERNAL HELPER FUNCTION sorting 'items' by key ('width' bytes); 'scratch' holds n more items.
+// Returns whichever of the two arrays ends up holding the sorted items.
+static RadixItem* radix_sort_items(RadixItem* items, RadixItem* scratch, size_t n, size_t width) {
+
+    // One read of the keys counts the digits of every pass
+    size_t (*counts)[256] = calloc(width, sizeof(*counts));
+    if (!counts) return NULL;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t key = items[i].key;
+        for (size_t pass = 0; pass < width; pass++) {
+            counts[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    RadixItem* from = items;
+    RadixItem* to = scratch;
+    for (size_t pass = 0; pass < width; pass++) {
+        size_t shift = pass * 8;
+
+        // Every key has the same digit here: this pass would not move anything
+        if (counts[pass][(from[0].key >> shift) & 0xFF] == n) continue;
+
+        size_t offsets[256];
+        size_t total = 0;
+        for (size_t digit = 0; digit < 256; digit++) {
+            offsets[digit] = total;
+            total += counts[pass][digit];
+        }
+        for (size_t i = 0; i < n; i++) {
+            to[offsets[(from[i].key >> shift) & 0xFF]++] = from[i];
+        }
+
+        RadixItem* swap = from;
+        from = to;
+        to = swap;
+    }
+
+    free(counts);
+    return from;
+}
+
+// INTERNAL HELPER FUNCTION for sort_list_by_key() on array-like storage: sorts a flat copy of the
+// elements and writes them back
+static ListResult storage_sort_by_key(LinkedList* list, size_t key_offset, size_t key_width, bool is_signed) {
+
+    size_t n = list->length;
+    size_t size = list->element_size;
+
+    unsigned char* elements = malloc(n * size);
+    RadixItem* items = malloc(2 * n * sizeof(RadixItem));
+    if (!elements || !items) {
+        free(elements);
+        free(items);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+    storage_copy_out(list, elements);
+
+    for (size_t i = 0; i < n; i++) {
+        unsigned char* element = elements + i * size;
+        items[i].key = radix_key(element + key_offset, key_width, is_signed);
+        items[i].item = element;
+    }
+
+    RadixItem* sorted = radix_sort_items(items, items + n, n, key_width);
+    if (!sorted) {
+        free(elements);
+        free(items);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    // Contiguous storage takes the sorted elements in place; unrolled blocks keep their counts
+    unsigned char* destination = list->storage == LIST_STORAGE_CONTIGUOUS ? contiguous_at(list, 0) : NULL;
+    unsigned char* flat = destination ? NULL : malloc(n * size);
+    if (!destination && !flat) {
+        free(elements);
+        free(items);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+    for (size_t i = 0; i < n; i++) {
+        memcpy((destination ? destination : flat) + i * size, sorted[i].item, size);
+    }
+    if (flat) unrolled_scatter(list, flat, 0);
+
+    free(flat);
+    free(elements);
+    free(items);
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Sorts the list in place by an integer key stored inside each element (ascending order).
+ * @param list The list to sort.
+ * @param key_offset Byte offset of the key inside an element (e.g. offsetof(Person, id)).
+ * @param key_width Size of the key in bytes: 1, 2, 4 or 8.
+ * @param is_signed true for signed integer keys, false for unsigned ones.
+ * @return LIST_SUCCESS, LIST_ERROR_INVALID_OPERATION for a bad width/offset, or LIST_ERROR_MEMORY_ALLOC.
+ * @note Stable LSD radix sort, O(n * key_width) with no comparisons. It needs 32 bytes of scratch
+ *       memory per element. Nodes are relinked like sort_list() does.
+ */
+ListResult sort_list_by_key(LinkedList* list, size_t key_offset, size_t key_width, bool is_signed) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (key_width != 1 && key_width != 2 && key_width != 4 && key_width != 8) return LIST_ERROR_INVALID_OPERATION;
+    if (key_offset > list->element_size || key_width > list->element_size - key_offset) return LIST_ERROR_INVALID_OPERATION;
+    if (list->length <= 1) return LIST_SUCCESS;
+    if (list->storage != LIST_STORAGE_NODES) return storage_sort_by_key(list, key_offset, key_width, is_signed);
+
+    size_t n = list->length;
+    RadixItem* items = malloc(2 * n * sizeof(RadixItem));
+    if (!items) return LIST_ERROR_MEMORY_ALLOC;
+
+    size_t i = 0;
+    for (Node* current = list->head->next; current != list->tail; current = current->next) {
+        items[i].key = radix_key((const unsigned char*)current->data + key_offset, key_width, is_signed);
+        items[i].item = current;
+        i++;
+    }
+
+    RadixItem* sorted = radix_sort_items(items, items + n, n, key_width);
+    if (!sorted) {
+        free(items);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    // Chain the nodes in key order, then restore prev pointers and the dummy head/tail links
+    for (i = 0; i + 1 < n; i++) {
+        ((Node*)sorted[i].item)->next = sorted[i + 1].item;
+    }
+    ((Node*)sorted[n - 1].item)->next = NULL;
+    attach_chain(list, sorted[0].item);
+    note_list_rearranged(list);
+
+    free(items);
+    return LIST_SUCCESS;
+}
+
+// Parallel sort: the list is cut into one run per thread, every run is sorted on its own thread,
+// then neighbouring runs are merged pairwise (a merge tree, each level's merges running in
+// parallel). Ties always go to the left run, so the result is the same as the stable serial sort.
+
+#define PARALLEL_SORT_MAX_THREADS 64
+#define PARALLEL_SORT_MIN_RUN 4096  // Fewer elements per thread are not worth a thread
+
+typedef struct {
+    CompareFunction compare_fn;
+    // Node storage: NULL-terminated chains; 'first' receives the result
+    Node* first;
+    Node* second;
+    // Array-like storage: runs [left, mid) and [mid, right) of 'from', merged into 'to'
+    unsigned char* from;
+    unsigned char* to;
+    size_t left, mid, right, size;
+    bool ok;
+} SortTask;
+
+// INTERNAL HELPER FUNCTION running work(&tasks[i]) for every task, one thread each
+// (the calling thread takes the first task; a task whose thread cannot start runs inline)
+static void run_sort_tasks(void* (*work)(void*), SortTask* tasks, size_t count) {
+
+    pthread_t threads[PARALLEL_SORT_MAX_THREADS];
+    bool started[PARALLEL_SORT_MAX_THREADS] = { false };
+
+    for (size_t i = 1; i < count; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, work, &tasks[i]) == 0);
+    }
+    work(&tasks[0]);
+    for (size_t i = 1; i < count; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+        else work(&tasks[i]);
+    }
+}
+
+static void* sort_chain_task(void* arg) {
+    SortTask* task = arg;
+    task->first = merge_sort_chain(task->first, task->compare_fn);
+    return NULL;
+}
+
+static void* merge_chains_task(void* arg) {
+    SortTask* task = arg;
+    task->first = merge_node_chains(task->first, task->second, task->compare_fn);
+    return NULL;
+}
+
+static void* sort_elements_task(void* arg) {
+    SortTask* task = arg;
+    task->ok = sort_elements(task->from + task->left * task->size, task->right - task->left,
+                             task->size, task->compare_fn);
+    return NULL;
+}
+
+static void* merge_elements_task(void* arg) {
+    SortTask* task = arg;
+    merge_element_runs(task->from, task->to, task->left, task->mid, task->right, task->size, task->compare_fn);
+    return NULL;
+}
+
+// INTERNAL HELPER FUNCTION for sort_list_parallel() on node storage
+static void sort_nodes_parallel(LinkedList* list, CompareFunction compare_fn, size_t threads) {
+
+    SortTask tasks[PARALLEL_SORT_MAX_THREADS];
+    size_t n = list->length;
+
+    // Cut the chain into 'threads' NULL-terminated runs of (almost) equal length
+    Node* current = list->head->next;
+    for (size_t t = 0; t < threads; t++) {
+        size_t run = n / threads + (t < n % threads);
+        tasks[t] = (SortTask){ .compare_fn = compare_fn, .first = current };
+        for (size_t i = 1; i < run; i++) current = current->next;
+        Node* next = current->next;
+        current->next = NULL;
+        current = next;
+    }
+    run_sort_tasks(sort_chain_task, tasks, threads);
+
+    // Merge neighbours until one run is left
+    for (size_t runs = threads; runs > 1; runs = (runs + 1) / 2) {
+        SortTask merges[PARALLEL_SORT_MAX_THREADS / 2];
+        size_t pairs = runs / 2;
+        for (size_t p = 0; p < pairs; p++) {
+            merges[p] = (SortTask){ .compare_fn = compare_fn, .first = tasks[2 * p].first, .second = tasks[2 * p + 1].first };
+        }
+        run_sort_tasks(merge_chains_task, merges, pairs);
+        for (size_t p = 0; p < pairs; p++) tasks[p].first = merges[p].first;
+        if (runs % 2) tasks[pairs].first = tasks[runs - 1].first;
+    }
+
+    attach_chain(list, tasks[0].first);
+    note_list_rearranged(list);
+}
+
+// INTERNAL HELPER FUNCTION for sort_list_parallel() on 'count' elements stored back to back
+static bool sort_elements_parallel(unsigned char* elements, size_t count, size_t size,
+                                   CompareFunction compare_fn, size_t threads) {
+
+    unsigned char* scratch = malloc(count * size);
+    if (!scratch) return false;
+
+    SortTask tasks[PARALLEL_SORT_MAX_THREADS];
+    size_t bounds[PARALLEL_SORT_MAX_THREADS + 1];
+    bounds[0] = 0;
+    for (size_t t = 0; t < threads; t++) {
+        bounds[t + 1] = bounds[t] + count / threads + (t < count % threads);
+        tasks[t] = (SortTask){ .compare_fn = compare_fn, .from = elements, .left = bounds[t],
+                               .right = bounds[t + 1], .size = size };
+    }
+    run_sort_tasks(sort_elements_task, tasks, threads);
+
+    bool ok = true;
+    for (size_t t = 0; t < threads; t++) ok = ok && tasks[t].ok;
+
+    // Merge neighbours, alternating between the two buffers (an odd last run is merged with nothing)
+    unsigned char* from = elements;
+    unsigned char* to = scratch;
+    for (size_t runs = threads; ok && runs > 1; runs = (runs + 1) / 2) {
+        size_t merges = (runs + 1) / 2;
+        for (size_t p = 0; p < merges; p++) {
+            size_t right = bounds[2 * p + 2 <= runs ? 2 * p + 2 : runs];
+            tasks[p] = (SortTask){ .compare_fn = compare_fn, .from = from, .to = to, .left = bounds[2 * p],
+                                   .mid = bounds[2 * p + 1], .right = right, .size = size };
+        }
+        run_sort_tasks(merge_elements_task, tasks, merges);
+        for (size_t p = 0; p < merges; p++) bounds[p + 1] = tasks[p].right;
+
+        unsigned char* swap = from;
+        from = to;
+        to = swap;
+    }
+
+    if (ok && from != elements) memcpy(elements, from, count * size);
+    free(scratch);
+    return ok;
+}
+
+/**
+ * @brief Sorts the list in place (ascending order) using several threads.
+ * @param list The list to sort.
+ * @param compare_fn Comparison function. It is called from several threads at once.
+ * @param nthreads Number of threads to use (1 behaves like sort_list()).
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Same stable order as sort_list(). Each thread sorts one run of the list, then the runs are
+ *       merged pairwise. Short lists use fewer threads (at least 4096 elements per thread).
+ */
+ListResult sort_list_parallel(LinkedList* list, CompareFunction compare_fn, size_t nthreads) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!compare_fn) return LIST_ERROR_NO_COMPARE_FUNCTION;
+    if (nthreads == 0) return LIST_ERROR_INVALID_OPERATION;
+
+    size_t threads = nthreads < PARALLEL_SORT_MAX_THREADS ? nthreads : PARALLEL_SORT_MAX_THREADS;
+    if (threads > list->length / PARALLEL_SORT_MIN_RUN) threads = list->length / PARALLEL_SORT_MIN_RUN;
+    if (threads <= 1) return sort_list(list, compare_fn);
+
+    if (list->storage == LIST_STORAGE_NODES) {
+        list->tail->prev->next = NULL;
+        sort_nodes_parallel(list, compare_fn, threads);
+        return LIST_SUCCESS;
+    }
+
+    bool sorted;
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        sorted = sort_elements_parallel(contiguous_at(list, 0), list->length, list->element_size, compare_fn, threads);
+    } else {
+        // Unrolled storage sorts a flat copy and writes it back into the same blocks
+        unsigned char* array = malloc(list->length * list->element_size);
+        sorted = false;
+        if (array) {
+            unrolled_gather(list, array);
+            sorted = sort_elements_parallel(array, list->length, list->element_size, compare_fn, threads);
+            if (sorted) unrolled_scatter(list, array, 0);
+            free(array);
+        }
+    }
+    if (!sorted) return LIST_ERROR_MEMORY_ALLOC;
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+// Selection (top_k, partial_sort_list, nth_element): elements are handled through an array of
+// small items. 'data' is what the compare function sees; 'owner' is the node holding it (node
+// storage) or its slot in a flat copy of the list (contiguous and unrolled storage).
+typedef struct {
+    void* data;
+    void* owner;
+    size_t index;  // Position in the list, breaks ties so results match the stable sort_list()
+} SelectItem;
+
+// INTERNAL HELPER FUNCTION telling whether item 'a' comes before item 'b' in sort_list() order
+static inline bool select_before(const SelectItem* a, const SelectItem* b, CompareFunction compare_fn) {
+    int cmp = compare_fn(a->data, b->data);
+    return cmp < 0 || (cmp == 0 && a->index < b->index);
+}
+
+// INTERNAL HELPER FUNCTION restoring the max-heap below 'i' (the root holds the item that comes last)
+static void select_heap_down(SelectItem* heap, size_t count, size_t i, CompareFunction compare_fn) {
+
+    SelectItem moving = heap[i];
+
+    while (2 * i + 1 < count) {
+        size_t child = 2 * i + 1;
+        if (child + 1 < count && select_before(&heap[child], &heap[child + 1], compare_fn)) child++;
+        if (!select_before(&moving, &heap[child], compare_fn)) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = moving;
+}
+
+// INTERNAL HELPER FUNCTION offering one more item to a max-heap holding the best 'k' items so far
+static void select_heap_offer(SelectItem* heap, size_t* count, size_t k, const SelectItem* item,
+                              CompareFunction compare_fn) {
+
+    if (*count < k) {
+        // Still filling up: sift the new item up from the bottom
+        size_t i = (*count)++;
+        while (i > 0 && select_before(&heap[(i - 1) / 2], item, compare_fn)) {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = *item;
+    } else if (select_before(item, &heap[0], compare_fn)) {
+        heap[0] = *item;
+        select_heap_down(heap, *count, 0, compare_fn);
+    }
+}
+
+// INTERNAL HELPER FUNCTION turning a max-heap into ascending order (heapsort's second half)
+static void select_heap_sort(SelectItem* heap, size_t count, CompareFunction compare_fn) {
+
+    while (count > 1) {
+        SelectItem last = heap[--count];
+        heap[count] = heap[0];
+        heap[0] = last;
+        select_heap_down(heap, count, 0, compare_fn);
+    }
+}
+
+// INTERNAL HELPER FUNCTION listing every element of 'list' as a SelectItem, in list order.
+// Array-like storage is copied into '*flat' first (the caller frees it), so the list itself can
+// be rewritten from the items afterwards. Returns NULL on allocation failure.
+static SelectItem* gather_select_items(const LinkedList* list, unsigned char** flat) {
+
+    *flat = NULL;
+    SelectItem* items = malloc(list->length * sizeof(SelectItem));
+    if (!items) return NULL;
+
+    if (list->storage == LIST_STORAGE_NODES) {
+        size_t i = 0;
+        for (Node* node = list->head->next; node != list->tail; node = node->next, i++) {
+            items[i] = (SelectItem){ node->data, node, i };
+        }
+        return items;
+    }
+
+    *flat = malloc(list->length * list->element_size);
+    if (!*flat) {
+        free(items);
+        return NULL;
+    }
+    storage_copy_out(list, *flat);
+    for (size_t i = 0; i < list->length; i++) {
+        unsigned char* slot = *flat + i * list->element_size;
+        items[i] = (SelectItem){ slot, slot, i };
+    }
+    return items;
+}
+
+// INTERNAL HELPER FUNCTION rewriting 'list' so that its elements follow the order of 'items'
+// (one item per element, as returned by gather_select_items)
+static ListResult apply_select_items(LinkedList* list, const SelectItem* items) {
+
+    size_t size = list->element_size;
+
+    if (list->storage == LIST_STORAGE_NODES) {
+        for (size_t i = 0; i + 1 < list->length; i++) {
+            ((Node*)items[i].owner)->next = items[i + 1].owner;
+        }
+        ((Node*)items[list->length - 1].owner)->next = NULL;
+        attach_chain(list, items[0].owner);
+        note_list_rearranged(list);
+        return LIST_SUCCESS;
+    }
+
+    if (list->storage == LIST_STORAGE_CONTIGUOUS) {
+        // The items point into a separate flat copy, so the list can be overwritten directly
+        for (size_t i = 0; i < list->length; i++) {
+            memcpy(contiguous_at(list, i), items[i].data, size);
+        }
+    } else {
+        unsigned char* array = malloc(list->length * size);
+        if (!array) return LIST_ERROR_MEMORY_ALLOC;
+        for (size_t i = 0; i < list->length; i++) {
+            memcpy(array + i * size, items[i].data, size);
+        }
+        unrolled_scatter(list, array, 0);
+        free(array);
+    }
+    list->version++;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Returns a new list holding the k smallest elements of the list, in ascending order.
+ * @param list The list to select from (not modified).
+ * @param k Number of elements to keep (the whole list if k exceeds its length).
+ * @param compare_fn Comparison function. Pass a reversed one to get the k largest elements.
+ * @return New list on success, NULL on failure (or if list is empty or k is 0).
+ * @note O(n log k) with a heap of k entries instead of sorting the whole list. The result is
+ *       exactly the first k elements sort_list() would produce, ties included.
+ */
+LinkedList* top_k(const LinkedList* list, size_t k, CompareFunction compare_fn) {
+
+    if (!list || !compare_fn || list->length == 0 || k == 0) return NULL;
+    if (k > list->length) k = list->length;
+
+    SelectItem* heap = malloc(k * sizeof(SelectItem));
+    if (!heap) return NULL;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+
+    size_t count = 0;
+    size_t index = 0;
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk), index++) {
+        SelectItem item = { element, NULL, index };
+        select_heap_offer(heap, &count, k, &item, compare_fn);
+    }
+    select_heap_sort(heap, count, compare_fn);
+
+    LinkedList* result = create_list_like(list, list->element_size);
+    if (result) {
+        copy_list_configuration(result, list);
+        for (size_t i = 0; i < count; i++) {
+            if (insert_tail_value_internal(result, heap[i].data) != LIST_SUCCESS) {
+                destroy(result);
+                result = NULL;
+                break;
+            }
+        }
+    }
+
+    free(heap);
+    return result;
+}
+
+/**
+ * @brief Moves the k smallest elements to the front of the list, in ascending order.
+ * @param list The list to rearrange.
+ * @param k Number of leading elements to put in order.
+ * @param compare_fn Comparison function.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note O(n log k). The first k elements end up exactly as after sort_list(); the order of the
+ *       remaining elements is unspecified (currently they keep their relative order). Node
+ *       storage relinks nodes, so pointers to elements stay valid.
+ */
+ListResult partial_sort_list(LinkedList* list, size_t k, CompareFunction compare_fn) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!compare_fn) return LIST_ERROR_NO_COMPARE_FUNCTION;
+    if (k == 0 || list->length <= 1) return LIST_SUCCESS;
+    if (k >= list->length) return sort_list(list, compare_fn);
+
+    unsigned char* flat;
+    SelectItem* items = gather_select_items(list, &flat);
+    SelectItem* order = malloc(list->length * sizeof(SelectItem));
+    if (!items || !order) {
+        free(items);
+        free(order);
+        free(flat);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    // The heap lives in the front of 'order'; the rest of it is filled once the k winners are known
+    size_t count = 0;
+    for (size_t i = 0; i < list->length; i++) {
+        select_heap_offer(order, &count, k, &items[i], compare_fn);
+    }
+    select_heap_sort(order, count, compare_fn);
+
+    // Flag the winners, then append everything else in list order
+    for (size_t i = 0; i < k; i++) {
+        items[order[i].index].owner = NULL;
+    }
+    size_t next = k;
+    for (size_t i = 0; i < list->length; i++) {
+        if (items[i].owner) order[next++] = items[i];
+    }
+
+    ListResult result = apply_select_items(list, order);
+    free(items);
+    free(order);
+    free(flat);
+    return result;
+}
+
+/**
+ * @brief Rearranges the list so that position n holds the element sort_list() would put there.
+ * @param list The list to rearrange.
+ * @param n Position to settle (e.g. length / 2 for the median).
+ * @param compare_fn Comparison function.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Quickselect, O(n) on average. Afterwards no element before position n compares greater
+ *       than it and no element after it compares smaller; both sides are otherwise unordered.
+ *       Read the result with get(list, n). Node storage relinks nodes instead of copying data.
+ */
+ListResult nth_element(LinkedList* list, size_t n, CompareFunction compare_fn) {
+
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (!compare_fn) return LIST_ERROR_NO_COMPARE_FUNCTION;
+    if (n >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    if (list->length == 1) return LIST_SUCCESS;
+
+    unsigned char* flat;
+    SelectItem* items = gather_select_items(list, &flat);
+    if (!items) return LIST_ERROR_MEMORY_ALLOC;
+
+    // Three-way partitioning around a random pivot: [low, lt) < pivot, [lt, gt] == pivot,
+    // (gt, high] > pivot. Runs of equal elements settle in one round instead of degrading.
+    size_t low = 0;
+    size_t high = list->length - 1;
+    uint64_t seed = 0x9E3779B97F4A7C15ull ^ list->length;
+
+    while (low < high) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        void* pivot = items[low + seed % (high - low + 1)].data;
+
+        size_t lt = low;
+        size_t gt = high;
+        size_t i = low;
+        while (i <= gt) {
+            int cmp = compare_fn(items[i].data, pivot);
+            SelectItem swap = items[i];
+            if (cmp < 0) {
+                items[i++] = items[lt];
+                items[lt++] = swap;
+            } else if (cmp > 0) {
+                items[i] = items[gt];
+                items[gt--] = swap;
+            } else {
+                i++;
+            }
+        }
+
+        if (n < lt) {
+            high = lt - 1;
+        } else if (n > gt) {
+            low = gt + 1;
+        } else {
+            break;
+        }
+    }
+
+    ListResult result = apply_select_items(list, items);
+    free(items);
+    free(flat);
+    return result;
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃         8. Structural Transformations         ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// INTERNAL HELPER to copy all function pointers from a source list to a destination list.
+static void copy_list_configuration(LinkedList* dest, const LinkedList* src) {
+    
+    if (!dest || !src) return;
+    
+    dest->print_node_function = src->print_node_function;
+    dest->free_node_function = src->free_node_function;
+    dest->copy_node_function = src->copy_node_function;
+    
+    // Copy struct name
+    if (src->struct_name) {
+        dest->struct_name = malloc(strlen(src->struct_name) + 1);
+        if (dest->struct_name) {
+            strcpy(dest->struct_name, src->struct_name);
+        }
+    }
+}
+
+// INTERNAL HELPER FUNCTION telling whether 'dest' can take over nodes of 'src' as they are.
+// Pool nodes live inside their pool's chunks and borrowed nodes inside their list's file mapping,
+// so they can only be copied, never handed over (and contiguous lists have no nodes at all).
+static bool can_adopt_nodes(const LinkedList* dest, const LinkedList* src) {
+    return !dest->pool && !src->pool && !src->mapping && dest->element_size == src->element_size &&
+           dest->storage == LIST_STORAGE_NODES && src->storage == LIST_STORAGE_NODES;
+}
+
+// INTERNAL HELPER FUNCTION for moving 'node' from 'src' into 'dest' without copying, in front of
+// 'position' (which ends up at 'index'). The caller must check can_adopt_nodes(). The source's
+// finger and index stop relying on the node.
+static void move_node_before(LinkedList* dest, Node* position, size_t index, LinkedList* src, Node* node) {
+
+    note_node_removed(src, node, LIST_INDEX_UNKNOWN);
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    src->length--;
+
+    // The external block of a pointer mode element now belongs to 'dest'
+    if (node->mode == LIST_MODE_POINTER) {
+        src->pointer_nodes--;
+        dest->pointer_nodes++;
+    }
+
+    link_node_before(dest, node, position, index);
+}
+
+/**
+ * @brief Creates a copy of the list.
+ * @param list The list to copy.
+ * @return A new list that is a copy of the original, or NULL on failure.
+ */
+LinkedList* copy(const LinkedList* list) {
+
+    if (!list) return NULL;
+    
+    LinkedList* new_list = create_list_like(list, list->element_size);
+    if (!new_list) return NULL;
+    
+    // Configure the new list with same settings as the original
+    copy_list_configuration(new_list, list);
+    
+    // Copy all elements from original list
+    ListResult extend_result = extend(new_list, list);
+    if (extend_result != LIST_SUCCESS) {
+        destroy(new_list);
+        return NULL;
+    }
+    
+    return new_list;
+}
+
+/**
+ * @brief Extends the list with elements from another list.
+ * @param list The list to extend.
+ * @param other The other list to extend with.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult extend(LinkedList* list, const LinkedList* other) {
+    
+    if (!list || !other) return LIST_ERROR_NULL_POINTER;
+    
+    ElementWalk walk;
+    walk_list(&walk, other, START_FROM_HEAD);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        // element already points to an element of size element_size,
+        // so we must call the internal function directly to avoid macro creating a void* temp (size mismatch)
+        ListResult result = insert_tail_value_internal(list, element);
+        if (result != LIST_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return LIST_SUCCESS;
+}
+
+
+/**
+ * @brief Creates a new list by concatenating two lists.
+ * @param list1 First list.
+ * @param list2 Second list.
+ * @return A new concatenated list, or NULL on failure.
+ */
+LinkedList* concat(const LinkedList* list1, const LinkedList* list2) {
+    if (!list1 || !list2) return NULL;
+    if (list1->element_size != list2->element_size) return NULL;
+    
+    LinkedList* concatenated = create_list_like(list1, list1->element_size);
+    if (!concatenated) return NULL;
+    
+    // Configure the concatenated list with settings from first list
+    copy_list_configuration(concatenated, list1);
+    
+    // Copy all elements from first list
+    if (extend(concatenated, list1) != LIST_SUCCESS) {
+        destroy(concatenated);
+        return NULL;
+    }
+    
+    // Copy all elements from second list
+    if (extend(concatenated, list2) != LIST_SUCCESS) {
+        destroy(concatenated);
+        return NULL;
+    }
+    
+    return concatenated;
+}
+
+// INTERNAL HELPER FUNCTION for counting pointer mode nodes among 'count' nodes starting at 'first'
+static size_t count_pointer_nodes(const LinkedList* list, Node* first, size_t count) {
+
+    // Most lists store a single mode, which makes the walk unnecessary
+    if (list->pointer_nodes == 0) return 0;
+    if (list->pointer_nodes == list->length) return count;
+
+    size_t pointers = 0;
+    for (size_t i = 0; i < count; i++, first = first->next) {
+        if (first->mode == LIST_MODE_POINTER) pointers++;
+    }
+    return pointers;
+}
+
+// INTERNAL CORE HELPER FUNCTION for moving the 'count' nodes first..last out of 'src' and in front of
+// 'position' in 'dest'. Adoptable nodes are relinked as one chain; pool nodes are re-homed one by one
+// (element bytes or pointer handed over as is - nothing is freed or deep-copied).
+static ListResult splice_chain(LinkedList* dest, Node* position, LinkedList* src, Node* first, Node* last, size_t count) {
+
+    if (count == 0) return LIST_SUCCESS;
+
+    // A full list that rejects new elements takes none of them
+    if (dest->max_size != UNLIMITED && dest->allow_overwrite == REJECT_NEW_WHEN_FULL &&
+        dest->length + count > dest->max_size) {
+        return LIST_ERROR_LIST_FULL;
+    }
+
+    ListResult result = LIST_SUCCESS;
+
+    if (can_adopt_nodes(dest, src)) {
+        size_t pointers = count_pointer_nodes(src, first, count);
+
+        // Cut the chain out of the source...
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+        src->length -= count;
+        src->pointer_nodes -= pointers;
+
+        // ...and link it in front of 'position'
+        first->prev = position->prev;
+        last->next = position;
+        position->prev->next = first;
+        position->prev = last;
+        dest->length += count;
+        dest->pointer_nodes += pointers;
+    } else {
+        Node* current = first;
+        for (size_t i = 0; i < count; i++) {
+            Node* next = current->next;
+
+            // Borrowed elements are copied, their memory stays with the source's mapping
+            ListMemoryMode mode = current->mode == LIST_MODE_BORROWED ? LIST_MODE_VALUE : current->mode;
+            Node* moved = create_node_generic(dest, current->data, mode);
+            if (!moved) {
+                result = LIST_ERROR_MEMORY_ALLOC; // Elements moved so far stay in 'dest'
+                break;
+            }
+            moved->next = position;
+            moved->prev = position->prev;
+            position->prev->next = moved;
+            position->prev = moved;
+            dest->length++;
+
+            // The element now lives in 'dest', so only the old node is released
+            current->prev->next = next;
+            next->prev = current->prev;
+            if (current->mode == LIST_MODE_POINTER) src->pointer_nodes--;
+            release_node(src, current);
+            src->length--;
+
+            current = next;
+        }
+    }
+
+    note_order_changed(src);
+    note_order_changed(dest);
+
+    // An overwriting list drops its oldest elements, as if they had been inserted one by one
+    ListResult trimmed = trim_to_max_size(dest);
+    return result != LIST_SUCCESS ? result : trimmed;
+}
+
+/**
+ * @brief Moves every element of 'other' to the end of 'list' without copying (O(1)).
+ * @param list The list to extend.
+ * @param other The list to take the elements from; it is left empty.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note A list with max_size and REJECT_NEW_WHEN_FULL takes either all elements or none
+ * (LIST_ERROR_LIST_FULL); with DELETE_OLD_WHEN_FULL the oldest elements are deleted afterwards.
+ * If either list has a node pool, the elements are moved one by one instead (O(n)); with a contiguous
+ * list on either side they are copied over (O(n)) and 'other' is emptied without its free function.
+ */
+ListResult extend_move(LinkedList* list, LinkedList* other) {
+
+    if (!list || !other) return LIST_ERROR_NULL_POINTER;
+    if (list == other || list->element_size != other->element_size) return LIST_ERROR_INVALID_OPERATION;
+
+    if (list->storage != LIST_STORAGE_NODES || other->storage != LIST_STORAGE_NODES) {
+        // No chain to relink: copy the elements over, then empty 'other' without running its free
+        // function (whatever the elements own now belongs to 'list')
+        if (list->max_size != UNLIMITED && list->allow_overwrite == REJECT_NEW_WHEN_FULL &&
+            list->length + other->length > list->max_size) {
+            return LIST_ERROR_LIST_FULL;
+        }
+        ListResult result = extend(list, other);
+        if (result != LIST_SUCCESS) return result;
+
+        FreeFunction free_fn = other->free_node_function;
+        other->free_node_function = NULL;
+        clear(other);
+        other->free_node_function = free_fn;
+        return LIST_SUCCESS;
+    }
+
+    return splice_chain(list, list->tail, other, other->head->next, other->tail->prev, other->length);
+}
+
+/**
+ * @brief Moves the elements [start, end) of 'src' into 'dest' in front of index 'dest_pos', without copying.
+ * @param dest The list to move the elements into.
+ * @param dest_pos Index in 'dest' the first moved element ends up at (beyond the length = append).
+ * @param src The list to take the elements from.
+ * @param start Start index in 'src' (inclusive).
+ * @param end End index in 'src' (exclusive, clamped to the length).
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Relinking is O(1); finding the positions costs the same as get(). max_size and node pools
+ * are handled as in extend_move(). Contiguous lists are rejected (LIST_ERROR_INVALID_OPERATION).
+ */
+ListResult splice_range(LinkedList* dest, size_t dest_pos, LinkedList* src, size_t start, size_t end) {
+
+    if (!dest || !src) return LIST_ERROR_NULL_POINTER;
+    if (dest == src || dest->element_size != src->element_size) return LIST_ERROR_INVALID_OPERATION;
+    if (dest->storage != LIST_STORAGE_NODES || src->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION;
+
+    if (end > src->length) end = src->length;
+    if (start > end) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+    if (start == end) return LIST_SUCCESS;
+
+    Node* first = find_node_by_index(src, start, src);
+    Node* last = find_node_by_index(src, end - 1, src);
+    Node* position = find_insert_position(dest, dest_pos, dest);
+
+    return splice_chain(dest, position, src, first, last, end - start);
+}
+
+
+/**
+ * @brief Creates a new list containing a slice of the original.
+ * @param list The source list.
+ * @param start Start index (inclusive).
+ * @param end End index (exclusive).
+ * @return A new sliced list, or NULL on failure.
+ */
+LinkedList* slice(const LinkedList* list, size_t start, size_t end) {
+    
+    if (!list || start >= end || start >= list->length) return NULL;
+    
+    if (end > list->length) end = list->length;
+    
+    LinkedList* sliced = create_list_like(list, list->element_size);
+    if (!sliced) return NULL;
+    
+    // Configure the sliced list with same settings as the original
+    copy_list_configuration(sliced, list);
+    
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    
+    // Skip to start position
+    for (size_t i = 0; i < start; i++) {
+        walk_next(&walk);
+    }
+    
+    // Copy elements from start to end
+    for (size_t i = start; i < end; i++) {
+        if (insert_tail_value_internal(sliced, walk_next(&walk)) != LIST_SUCCESS) {
+            destroy(sliced);
+            return NULL;
+        }
+    }
+    
+    return sliced;
+}
+
+/**
+ * @brief Rotates the list elements by a specified number of positions.
+ * @param list The list to rotate.
+ * @param positions Number of positions to rotate (positive = right, negative = left).
+ * @return LIST_SUCCESS on success, error code otherwise.
+ */
+ListResult rotate(LinkedList* list, int positions) {
+    if (!list || list->length <= 1) return LIST_SUCCESS;
+    
+    // Normalize positions to be within list length
+    int actual_positions = positions % (int)list->length;
+    
+    if (actual_positions < 0) {
+        actual_positions += list->length;
+    }
+    
+    if (actual_positions == 0) return LIST_SUCCESS;
+    if (list->storage != LIST_STORAGE_NODES) return storage_rotate(list, (size_t)actual_positions);
+    
+    // Find the split point
+    Node* split_point = list->head->next;
+    for (int i = 0; i < actual_positions; i++) {
+        split_point = split_point->next;
+    }
+    
+    // If split point is at the end, no rotation needed
+    if (split_point == list->tail) return LIST_SUCCESS;
+    
+    // Save the nodes we're moving
+    Node* first_part_start = list->head->next;
+    Node* first_part_end = split_point->prev;
+    Node* second_part_start = split_point;
+    Node* second_part_end = list->tail->prev;
+    
+    // Reconnect: dummy_head -> second_part -> first_part -> dummy_tail
+    list->head->next = second_part_start;
+    second_part_start->prev = list->head;
+    
+    second_part_end->next = first_part_start;
+    first_part_start->prev = second_part_end;
+    
+    first_part_end->next = list->tail;
+    list->tail->prev = first_part_end;
+    note_list_rearranged(list);
+    
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Reverses the list in place.
+ * @param list The list to reverse.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult reverse(LinkedList* list) {
+    
+    if (!list) return LIST_ERROR_NULL_POINTER;
+    if (list->length <= 1) return LIST_SUCCESS;
+    if (list->storage != LIST_STORAGE_NODES) return storage_reverse(list);
+    
+    Node* current = list->head->next;
+    Node* prev_node = list->head;
+    
+    // Swap next and prev pointers for each node
+    while (current != list->tail) {
+        Node* next_node = current->next;
+        current->next = prev_node;
+        current->prev = next_node;
+        prev_node = current;
+        current = next_node;
+    }
+    
+    // Update dummy nodes
+    list->head->next = prev_node;
+    prev_node->prev = list->head;
+    list->tail->prev = list->head->next;
+    
+    // Fix the last node
+    current = list->head->next;
+    while (current->next != list->head) {
+        current = current->next;
+    }
+    current->next = list->tail;
+    list->tail->prev = current;
+    note_list_rearranged(list);
+    
+    return LIST_SUCCESS;
+}
+
+// INTERNAL HELPER FUNCTION for filter(): copies the passing elements of a walk over 'list'
+static LinkedList* filter_walk(const LinkedList* list, ElementWalk* walk, FilterFunction filter_fn) {
+
+    LinkedList* filtered = create_list_like(list, list->element_size);
+    if (!filtered) return NULL;
+    
+    // Configure the filtered list with same settings as the original
+    copy_list_configuration(filtered, list);
+    
+    for (void* element = walk_next(walk); element; element = walk_next(walk)) {
+        if (filter_fn(element)) {
+            if (insert_tail_value_internal(filtered, element) != LIST_SUCCESS) {
+                destroy(filtered);
+                return NULL;
+            }
+        }
+    }
+    
+    return filtered;
+}
+
+/**
+ * @brief Creates a new list with elements that pass the filter function.
+ * @param list The source list.
+ * @param filter_fn Function to test each element.
+ * @return A new filtered list, or NULL on failure.
+ */
+LinkedList* filter(const LinkedList* list, FilterFunction filter_fn) {
+    
+    if (!list || !filter_fn) return NULL;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    return filter_walk(list, &walk, filter_fn);
+}
+
+// INTERNAL HELPER FUNCTION for map(): transforms the elements of a walk over 'list' into a new list
+static LinkedList* map_walk(const LinkedList* list, ElementWalk* walk, MapFunction map_fn, size_t new_element_size) {
+
+    LinkedList* mapped = create_list_like(list, new_element_size);
+    if (!mapped) return NULL;
+    
+    // Don't copy the original list's free/copy functions since the new list 
+    // may contain a different data type that requires different handling
+    
+    void* transformed = malloc(new_element_size);
+    if (!transformed) {
+        destroy(mapped);
+        return NULL;
+    }
+
+    for (void* element = walk_next(walk); element; element = walk_next(walk)) {
+        map_fn(transformed, element);
+        
+        if (insert_tail_value_internal(mapped, transformed) != LIST_SUCCESS) {
+            free(transformed);
+            destroy(mapped);
+            return NULL;
+        }
+    }
+    
+    free(transformed);
+    return mapped;
+}
+
+/**
+ * @brief Creates a new list with transformed elements.
+ * @param list The source list.
+ * @param map_fn Function to transform each element.
+ * @param new_element_size Size of elements in the new list.
+ * @return A new transformed list, or NULL on failure.
+ */
+LinkedList* map(const LinkedList* list, MapFunction map_fn, size_t new_element_size) {
+    if (!list || !map_fn) return NULL;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    return map_walk(list, &walk, map_fn, new_element_size);
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃              8B. Slice Views                  ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+/**
+ * @brief Creates a read-only view of the elements [start, end) without copying them.
+ * @param list The parent list.
+ * @param start Start index (inclusive).
+ * @param end End index (exclusive, clamped to the length).
+ * @param out_view Receives the view.
+ * @return LIST_SUCCESS on success, error code on failure.
+ * @note Finding the boundaries costs the same as get(); everything after that only walks the view.
+ */
+ListResult list_view(const LinkedList* list, size_t start, size_t end, ListView* out_view) {
+
+    if (!list || !out_view) return LIST_ERROR_NULL_POINTER;
+    if (list->storage != LIST_STORAGE_NODES) return LIST_ERROR_INVALID_OPERATION; // Views hold boundary nodes
+
+    if (end > list->length) end = list->length;
+    if (start > end) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;
+
+    // 'end' may be the dummy tail; an empty view has first == end
+    Node* end_node = find_insert_position(list, end, NULL);
+    Node* first = (start == end) ? end_node : find_node_by_index(list, start, NULL);
+
+    out_view->list = list;
+    out_view->first = first;
+    out_view->end = end_node;
+    out_view->start = start;
+    out_view->length = end - start;
+    out_view->version = list->version;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Checks that the parent list has not been structurally changed since the view was taken.
+ * @param view The view to check.
+ * @return true if the view can still be used.
+ */
+bool view_is_valid(const ListView* view) {
+    return view && view->list && view->version == view->list->version;
+}
+
+/**
+ * @brief count_matching() over a view.
+ * @param view The view to scan.
+ * @param predicate Condition to count.
+ * @return The number of matching elements (0 if the view is no longer valid).
+ */
+size_t view_count_matching(const ListView* view, PredicateFunction predicate) {
+    if (!view_is_valid(view) || !predicate) return 0;
+
+    ElementWalk walk;
+    walk_nodes(&walk, view->first, view->end);
+    return count_matching_walk(&walk, predicate);
+}
+
+/**
+ * @brief min_by() over a view.
+ * @param view The view to search.
+ * @param compare_fn Comparison function.
+ * @return Pointer to the smallest element, or NULL if the view is empty or no longer valid.
+ */
+void* view_min_by(const ListView* view, CompareFunction compare_fn) {
+    if (!view_is_valid(view) || !compare_fn || view->length == 0) return NULL;
+
+    ElementWalk walk;
+    walk_nodes(&walk, view->first, view->end);
+    return extreme_in_walk(&walk, compare_fn, -1);
+}
+
+/**
+ * @brief max_by() over a view.
+ * @param view The view to search.
+ * @param compare_fn Comparison function.
+ * @return Pointer to the largest element, or NULL if the view is empty or no longer valid.
+ */
+void* view_max_by(const ListView* view, CompareFunction compare_fn) {
+    if (!view_is_valid(view) || !compare_fn || view->length == 0) return NULL;
+
+    ElementWalk walk;
+    walk_nodes(&walk, view->first, view->end);
+    return extreme_in_walk(&walk, compare_fn, 1);
+}
+
+/**
+ * @brief to_array() over a view.
+ * @param view The view to copy out.
+ * @param out_size Receives the number of elements.
+ * @return Newly allocated array (caller frees), or NULL if empty, invalid or out of memory.
+ */
+void* view_to_array(const ListView* view, size_t* out_size) {
+    if (!out_size) return NULL;
+    *out_size = 0;
+    if (!view_is_valid(view)) return NULL;
+
+    *out_size = view->length;
+    ElementWalk walk;
+    walk_nodes(&walk, view->first, view->end);
+    return walk_to_array(&walk, view->length, view->list->element_size);
+}
+
+/**
+ * @brief filter() over a view.
+ * @param view The view to filter.
+ * @param filter_fn Function to test each element.
+ * @return A new list with the passing elements, or NULL on failure.
+ */
+LinkedList* view_filter(const ListView* view, FilterFunction filter_fn) {
+    if (!view_is_valid(view) || !filter_fn) return NULL;
+
+    ElementWalk walk;
+    walk_nodes(&walk, view->first, view->end);
+    return filter_walk(view->list, &walk, filter_fn);
+}
+
+/**
+ * @brief map() over a view.
+ * @param view The view to transform.
+ * @param map_fn Function to transform each element.
+ * @param new_element_size Size of elements in the new list.
+ * @return A new transformed list, or NULL on failure.
+ */
+LinkedList* view_map(const ListView* view, MapFunction map_fn, size_t new_element_size) {
+    if (!view_is_valid(view) || !map_fn) return NULL;
+
+    ElementWalk walk;
+    walk_nodes(&walk, view->first, view->end);
+    return map_walk(view->list, &walk, map_fn, new_element_size);
+}
+
+/**
+ * @brief Creates a read-only forward cursor over a view (indices count from the view's start).
+ * @param view The view to traverse.
+ * @return The cursor (not valid if the view is empty or no longer valid).
+ */
+ListCursor view_cursor_begin(const ListView* view) {
+    ListCursor cursor = { NULL, NULL, 0, START_FROM_HEAD, NULL, NULL, true };
+    if (!view_is_valid(view)) return cursor;
+
+    cursor.list = (LinkedList*)view->list; // read_only keeps the cursor from modifying it
+    cursor.node = view->first;
+    cursor.before_first = view->first->prev;
+    cursor.after_last = view->end;
+    return cursor;
+}
+
+/**
+ * @brief Creates a read-only reverse cursor over a view (indices count from the view's start).
+ * @param view The view to traverse.
+ * @return The cursor (not valid if the view is empty or no longer valid).
+ */
+ListCursor view_cursor_rbegin(const ListView* view) {
+    ListCursor cursor = { NULL, NULL, 0, START_FROM_TAIL, NULL, NULL, true };
+    if (!view_is_valid(view)) return cursor;
+
+    cursor.list = (LinkedList*)view->list;
+    cursor.node = view->end->prev;
+    cursor.index = view->length - 1;
+    cursor.before_first = view->first->prev;
+    cursor.after_last = view->end;
+    return cursor;
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃             8C. Lazy Pipelines                ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// A pipeline records its stages and runs them only when a terminal function (collect, count,
+// reduce, min, max) is called. Each element of the source then flows through every stage in a
+// single pass over the node chain; map stages write into their own scratch buffer, so nothing
+// is allocated per element and no intermediate list is ever built.
+
+typedef enum {
+    STAGE_FILTER,
+    STAGE_MAP,
+    STAGE_TAKE,
+    STAGE_SKIP
+} PipelineStageKind;
+
+typedef struct {
+    PipelineStageKind kind;
+    FilterFunction filter_fn;   // STAGE_FILTER
+    MapFunction map_fn;         // STAGE_MAP
+    void* output;               // STAGE_MAP: scratch buffer for the transformed element
+    size_t limit;               // STAGE_TAKE / STAGE_SKIP: number of elements
+    size_t seen;                // STAGE_TAKE / STAGE_SKIP: elements reached this stage in the current run
+} PipelineStage;
+
+struct ListPipeline {
+    const LinkedList* list;     // Source list
+    bool from_view;             // Source is 'view' rather than the whole list
+    ListView view;
+    PipelineStage* stages;
+    size_t stage_count;
+    size_t stage_capacity;
+    size_t element_size;        // Size of the elements leaving the last stage
+    bool mapped;                // A map stage changed the element type
+};
+
+// What a terminal function does with every element that leaves the last stage
+typedef enum {
+    SINK_COLLECT,
+    SINK_COUNT,
+    SINK_REDUCE,
+    SINK_MIN,
+    SINK_MAX
+} PipelineSinkKind;
+
+typedef struct {
+    PipelineSinkKind kind;
+    LinkedList* collected;      // SINK_COLLECT
+    size_t count;               // Elements that reached the sink
+    ReduceFunction reduce_fn;   // SINK_REDUCE
+    CompareFunction compare_fn; // SINK_MIN / SINK_MAX
+    void* target;               // SINK_REDUCE: accumulator, SINK_MIN / SINK_MAX: best element so far
+} PipelineSink;
+
+// INTERNAL HELPER FUNCTION for creating an empty pipeline over the given source
+static ListPipeline* pipeline_create(const LinkedList* list, const ListView* view) {
+
+    ListPipeline* pipeline = malloc(sizeof(ListPipeline));
+    if (!pipeline) return NULL;
+
+    pipeline->list = list;
+    pipeline->from_view = (view != NULL);
+    if (view) pipeline->view = *view;
+    pipeline->stages = NULL;
+    pipeline->stage_count = 0;
+    pipeline->stage_capacity = 0;
+    pipeline->element_size = list->element_size;
+    pipeline->mapped = false;
+    return pipeline;
+}
+
+// INTERNAL HELPER FUNCTION for appending a stage (returns NULL if out of memory)
+static PipelineStage* pipeline_add_stage(ListPipeline* pipeline, PipelineStageKind kind) {
+
+    if (pipeline->stage_count == pipeline->stage_capacity) {
+        size_t capacity = pipeline->stage_capacity ? pipeline->stage_capacity * 2 : 4;
+        PipelineStage* stages = realloc(pipeline->stages, capacity * sizeof(PipelineStage));
+        if (!stages) return NULL;
+        pipeline->stages = stages;
+        pipeline->stage_capacity = capacity;
+    }
+
+    PipelineStage* stage = &pipeline->stages[pipeline->stage_count++];
+    memset(stage, 0, sizeof(*stage));
+    stage->kind = kind;
+    return stage;
+}
+
+// INTERNAL HELPER FUNCTION handing one finished element to the terminal
+static ListResult pipeline_sink_accept(PipelineSink* sink, void* element, size_t element_size) {
+
+    sink->count++;
+
+    switch (sink->kind) {
+        case SINK_COLLECT:
+            return insert_tail_value_internal(sink->collected, element);
+        case SINK_REDUCE:
+            sink->reduce_fn(sink->target, element);
+            break;
+        case SINK_MIN:
+        case SINK_MAX: {
+            // The element may live in a scratch buffer, so the best one is copied out
+            int sign = (sink->kind == SINK_MIN) ? -1 : 1;
+            if (sink->count == 1 || sign * sink->compare_fn(element, sink->target) > 0) {
+                memcpy(sink->target, element, element_size);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return LIST_SUCCESS;
+}
+
+// INTERNAL CORE HELPER FUNCTION running every stage over the source in one traversal
+static ListResult pipeline_run(ListPipeline* pipeline, PipelineSink* sink) {
+
+    ElementWalk walk;
+    if (pipeline->from_view) {
+        if (!view_is_valid(&pipeline->view)) return LIST_ERROR_INVALID_OPERATION;
+        walk_nodes(&walk, pipeline->view.first, pipeline->view.end);
+    } else {
+        walk_list(&walk, pipeline->list, START_FROM_HEAD);
+    }
+
+    for (size_t i = 0; i < pipeline->stage_count; i++) {
+        pipeline->stages[i].seen = 0;
+    }
+
+    for (void* source = walk_next(&walk); source; source = walk_next(&walk)) {
+        void* element = source;
+        bool passed = true;
+        bool finished = false;
+
+        for (size_t i = 0; i < pipeline->stage_count && passed; i++) {
+            PipelineStage* stage = &pipeline->stages[i];
+            switch (stage->kind) {
+                case STAGE_FILTER:
+                    passed = stage->filter_fn(element);
+                    break;
+                case STAGE_MAP:
+                    stage->map_fn(stage->output, element);
+                    element = stage->output;
+                    break;
+                case STAGE_SKIP:
+                    passed = (stage->seen++ >= stage->limit);
+                    break;
+                case STAGE_TAKE:
+                    passed = (stage->seen < stage->limit);
+                    if (passed) stage->seen++;
+                    // Once full, no later element can get past this stage
+                    if (stage->seen == stage->limit) finished = true;
+                    break;
+            }
+        }
+
+        if (passed) {
+            ListResult result = pipeline_sink_accept(sink, element, pipeline->element_size);
+            if (result != LIST_SUCCESS) return result;
+        }
+        if (finished) break;
+    }
+
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Starts a lazy pipeline over a whole list.
+ * @param list The source list (read when a terminal function runs, not now).
+ * @return The pipeline (free with pipeline_destroy()), or NULL on failure.
+ */
+ListPipeline* pipeline_from_list(const LinkedList* list) {
+    if (!list) return NULL;
+    return pipeline_create(list, NULL);
+}
+
+/**
+ * @brief Starts a lazy pipeline over a view.
+ * @param view The source view; terminal functions fail once it is no longer valid.
+ * @return The pipeline (free with pipeline_destroy()), or NULL on failure.
+ */
+ListPipeline* pipeline_from_view(const ListView* view) {
+    if (!view || !view->list) return NULL;
+    return pipeline_create(view->list, view);
+}
+
+/**
+ * @brief Adds a stage that only lets elements passing 'filter_fn' through.
+ * @param pipeline The pipeline to extend.
+ * @param filter_fn Function to test each element.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult pipeline_filter(ListPipeline* pipeline, FilterFunction filter_fn) {
+    if (!pipeline || !filter_fn) return LIST_ERROR_NULL_POINTER;
+
+    PipelineStage* stage = pipeline_add_stage(pipeline, STAGE_FILTER);
+    if (!stage) return LIST_ERROR_MEMORY_ALLOC;
+    stage->filter_fn = filter_fn;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Adds a stage that transforms every element.
+ * @param pipeline The pipeline to extend.
+ * @param map_fn Function to transform each element.
+ * @param new_element_size Size of the transformed elements.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult pipeline_map(ListPipeline* pipeline, MapFunction map_fn, size_t new_element_size) {
+    if (!pipeline || !map_fn) return LIST_ERROR_NULL_POINTER;
+    if (new_element_size == 0) return LIST_ERROR_INVALID_OPERATION;
+
+    void* output = malloc(new_element_size);
+    if (!output) return LIST_ERROR_MEMORY_ALLOC;
+
+    PipelineStage* stage = pipeline_add_stage(pipeline, STAGE_MAP);
+    if (!stage) {
+        free(output);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+    stage->map_fn = map_fn;
+    stage->output = output;
+
+    pipeline->element_size = new_element_size;
+    pipeline->mapped = true;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Adds a stage that lets only the first 'count' elements reaching it through.
+ * The traversal stops as soon as it is full.
+ * @param pipeline The pipeline to extend.
+ * @param count Number of elements to keep.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult pipeline_take(ListPipeline* pipeline, size_t count) {
+    if (!pipeline) return LIST_ERROR_NULL_POINTER;
+
+    PipelineStage* stage = pipeline_add_stage(pipeline, STAGE_TAKE);
+    if (!stage) return LIST_ERROR_MEMORY_ALLOC;
+    stage->limit = count;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Adds a stage that drops the first 'count' elements reaching it.
+ * @param pipeline The pipeline to extend.
+ * @param count Number of elements to drop.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult pipeline_skip(ListPipeline* pipeline, size_t count) {
+    if (!pipeline) return LIST_ERROR_NULL_POINTER;
+
+    PipelineStage* stage = pipeline_add_stage(pipeline, STAGE_SKIP);
+    if (!stage) return LIST_ERROR_MEMORY_ALLOC;
+    stage->limit = count;
+    return LIST_SUCCESS;
+}
+
+/**
+ * @brief Runs the pipeline and collects its output into a new list.
+ * @param pipeline The pipeline to run (it can be run again later).
+ * @return A new list, or NULL on failure.
+ * @note Without map stages the new list takes over the source list's configuration, like filter().
+ */
+LinkedList* pipeline_collect(ListPipeline* pipeline) {
+    if (!pipeline) return NULL;
+
+    LinkedList* collected = create_list_like(pipeline->list, pipeline->element_size);
+    if (!collected) return NULL;
+    if (!pipeline->mapped) {
+        copy_list_configuration(collected, pipeline->list);
+    }
+
+    PipelineSink sink = { SINK_COLLECT, collected, 0, NULL, NULL, NULL };
+    if (pipeline_run(pipeline, &sink) != LIST_SUCCESS) {
+        destroy(collected);
+        return NULL;
+    }
+    return collected;
+}
+
+/**
+ * @brief Runs the pipeline and counts its output.
+ * @param pipeline The pipeline to run.
+ * @return The number of elements produced (0 on failure).
+ */
+size_t pipeline_count(ListPipeline* pipeline) {
+    if (!pipeline) return 0;
+
+    PipelineSink sink = { SINK_COUNT, NULL, 0, NULL, NULL, NULL };
+    if (pipeline_run(pipeline, &sink) != LIST_SUCCESS) return 0;
+    return sink.count;
+}
+
+/**
+ * @brief Runs the pipeline and folds its output into 'accumulator'.
+ * @param pipeline The pipeline to run.
+ * @param reduce_fn Called as reduce_fn(accumulator, element) for every element produced.
+ * @param accumulator The caller's accumulator, initialized by the caller.
+ * @return LIST_SUCCESS on success, error code on failure.
+ */
+ListResult pipeline_reduce(ListPipeline* pipeline, ReduceFunction reduce_fn, void* accumulator) {
+    if (!pipeline || !reduce_fn || !accumulator) return LIST_ERROR_NULL_POINTER;
+
+    PipelineSink sink = { SINK_REDUCE, NULL, 0, reduce_fn, NULL, accumulator };
+    return pipeline_run(pipeline, &sink);
+}
+
+// INTERNAL HELPER FUNCTION shared by pipeline_min/pipeline_max
+static ListResult pipeline_extreme(ListPipeline* pipeline, CompareFunction compare_fn, void* out_element, PipelineSinkKind kind) {
+    if (!pipeline || !compare_fn || !out_element) return LIST_ERROR_NULL_POINTER;
+
+    PipelineSink sink = { kind, NULL, 0, NULL, compare_fn, out_element };
+    ListResult result = pipeline_run(pipeline, &sink);
+    if (result != LIST_SUCCESS) return result;
+    return sink.count ? LIST_SUCCESS : LIST_ERROR_ELEMENT_NOT_FOUND;
+}
+
+/**
+ * @brief Runs the pipeline and copies its smallest output element into 'out_element'.
+ * @param pipeline The pipeline to run.
+ * @param compare_fn Comparison function for the output elements.
+ * @param out_element Receives a copy of the element (size of the last stage's output).
+ * @return LIST_SUCCESS, LIST_ERROR_ELEMENT_NOT_FOUND if nothing was produced, or another error code.
+ */
+ListResult pipeline_min(ListPipeline* pipeline, CompareFunction compare_fn, void* out_element) {
+    return pipeline_extreme(pipeline, compare_fn, out_element, SINK_MIN);
+}
+
+/**
+ * @brief Runs the pipeline and copies its largest output element into 'out_element'.
+ * @param pipeline The pipeline to run.
+ * @param compare_fn Comparison function for the output elements.
+ * @param out_element Receives a copy of the element (size of the last stage's output).
+ * @return LIST_SUCCESS, LIST_ERROR_ELEMENT_NOT_FOUND if nothing was produced, or another error code.
+ */
+ListResult pipeline_max(ListPipeline* pipeline, CompareFunction compare_fn, void* out_element) {
+    return pipeline_extreme(pipeline, compare_fn, out_element, SINK_MAX);
+}
+
+/**
+ * @brief Frees a pipeline (the source list is not touched).
+ * @param pipeline The pipeline to free.
+ */
+void pipeline_destroy(ListPipeline* pipeline) {
+    if (!pipeline) return;
+
+    for (size_t i = 0; i < pipeline->stage_count; i++) {
+        free(pipeline->stages[i].output);
+    }
+    free(pipeline->stages);
+    free(pipeline);
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃           9. Mathematical Functions           ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// INTERNAL HELPER FUNCTION for min_by/max_by over the elements of a non-empty walk.
+// 'sign' is -1 for the minimum and +1 for the maximum; ties keep the earliest element.
+static void* extreme_in_walk(ElementWalk* walk, CompareFunction compare, int sign) {
+
+    void* best = walk_next(walk);
+    for (void* element = walk_next(walk); element; element = walk_next(walk)) {
+        if (sign * compare(element, best) > 0) {
+            best = element;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Finds the minimum element in the list based on a custom comparison function.
+ * @param list The list to search in.
+ * @param compare A function pointer to compare two elements. Should return < 0 if a < b, 0 if a == b, > 0 if a > b.
+ * @return A direct pointer to the minimum element's data, or NULL if the list is empty or compare function is not provided.
+ */
+void* min_by(const LinkedList* list, int (*compare)(const void *a, const void *b)) {
+    if (is_empty(list) || !compare) return NULL;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    return extreme_in_walk(&walk, compare, -1);
+}
+
+/**
+ * @brief Finds the maximum element in the list based on a custom comparison function.
+ * @param list The list to search in.
+ * @param compare A function pointer to compare two elements. Should return < 0 if a < b, 0 if a == b, > 0 if a > b.
+ * @return A direct pointer to the maximum element's data, or NULL if the list is empty or compare function is not provided.
+ */
+void* max_by(const LinkedList* list, int (*compare)(const void *a, const void *b)) {
+    if (is_empty(list) || !compare) return NULL;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    return extreme_in_walk(&walk, compare, 1);
+}
+
+/**
+ * @brief Helper function to find index of element using compare function.
+ * @param list The list to search in.
+ * @param data The data to search for.
+ * @param compare_fn Comparison function.
+ * @return Index if found, -1 if not found.
+ */
+static int index_of_with_compare(const LinkedList* list, const void* data, CompareFunction compare_fn) {
+    if (!list || !data || !compare_fn) return -1;
+    
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    int index = 0;
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        if (compare_fn(element, data) == 0) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Creates a new list with unique elements based on the default compare function, preserving the first occurrence.
+ * @param list The source list.
+ * @return A new list with unique elements, or NULL on failure.
+ */
+LinkedList* unique(const LinkedList* list, CompareFunction compare_fn) { 
+    return unique_advanced(list, compare_fn, START_FROM_HEAD); 
+}
+
+/**
+ * @brief Creates a new list with unique elements based on a custom comparison function and preservation order.
+ * @param list The source list.
+ * @param custom_compare A function to determine uniqueness. If NULL, the list's default compare function is used.
+ * @param order START_FROM_HEAD to keep the first seen unique element, START_FROM_TAIL to keep the last.
+ * @return A new list with unique elements, or NULL on failure.
+ */
+LinkedList* unique_advanced(const LinkedList* list, CompareFunction compare_fn, Direction order) {
+    if (!list) return NULL;
+    if (!compare_fn) return NULL;
+
+    LinkedList* unique_list = create_list_like(list, list->element_size);
+    if (!unique_list) return NULL;
+
+    copy_list_configuration(unique_list, list);
+
+    // To preserve the last occurrence, we iterate the source list in reverse.
+    ElementWalk walk;
+    walk_list(&walk, list, order);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+
+        // Check if the element is already in our unique list.
+        if (index_of_with_compare(unique_list, element, compare_fn) != -1) continue;
+
+        // When iterating backwards, we insert at the head to maintain the original relative order.
+        ListResult result = (order == START_FROM_TAIL) ? insert_head_value_internal(unique_list, element)
+                                                       : insert_tail_value_internal(unique_list, element);
+        if (result != LIST_SUCCESS) {
+            destroy(unique_list);
+            return NULL;
+        }
+    }
+
+    return unique_list;
+}
+
+/**
+ * @brief Creates a new list containing the intersection of two lists.
+ * @param list1 First list.
+ * @param list2 Second list.
+ * @return A new list with common elements, or NULL on failure.
+ */
+LinkedList* intersection(const LinkedList* list1, const LinkedList* list2, CompareFunction compare_fn) {
+    if (!list1 || !list2 || !compare_fn) return NULL;
+    if (list1->element_size != list2->element_size) return NULL;
+    
+    LinkedList* intersection = create_list_like(list1, list1->element_size);
+    if (!intersection) return NULL;
+    
+    // Configure the intersection list with settings from first list
+    copy_list_configuration(intersection, list1);
+    
+    ElementWalk walk;
+    walk_list(&walk, list1, START_FROM_HEAD);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+
+        // If element exists in both lists and not already in result
+        if (index_of_with_compare(list2, element, compare_fn) != -1 && 
+            index_of_with_compare(intersection, element, compare_fn) == -1) {
+            if (insert_tail_value_internal(intersection, element) != LIST_SUCCESS) {
+                destroy(intersection);
+                return NULL;
+            }
+        }
+    }
+    
+    return intersection;
+}
+
+/**
+ * @brief Creates a new list containing the union of two lists.
+ * @param list1 First list.
+ * @param list2 Second list.
+ * @return A new list with all unique elements from both lists, or NULL on failure.
+ */
+LinkedList* union_lists(const LinkedList* list1, const LinkedList* list2, CompareFunction compare_fn) {
+    if (!list1 || !list2 || !compare_fn) return NULL;
+    if (list1->element_size != list2->element_size) return NULL;
+    
+    // Start with unique elements from first list
+    LinkedList* union_list = unique(list1, compare_fn);
+    if (!union_list) return NULL;
+    
+    // Add unique elements from second list
+    ElementWalk walk;
+    walk_list(&walk, list2, START_FROM_HEAD);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        if (index_of_with_compare(union_list, element, compare_fn) == -1) {
+            if (insert_tail_value_internal(union_list, element) != LIST_SUCCESS) {
+                destroy(union_list);
+                return NULL;
+            }
+        }
+    }
+    
+    return union_list;
+}
+
+// Element hash set used by the *_hashed functions: open addressing with linear probing.
+// It stores pointers to element data (nothing is copied) and is sized up front to stay at
+// most half full, so it never needs to grow.
+typedef struct {
+    const void* data;       // Element in this slot (NULL = empty)
+    size_t hash;            // Mixed hash of data, compared before calling compare_fn
+    bool marked;            // Caller's flag (intersection: already added to the result)
+} HashSlot;
+
+typedef struct {
+    HashSlot* slots;
+    size_t mask;            // Capacity - 1 (capacity is a power of two)
+    HashFunction hash_fn;
+    CompareFunction compare_fn;
+} HashSet;
+
+// INTERNAL HELPER FUNCTION for allocating a set that can hold 'expected' distinct elements
+static bool hash_set_init(HashSet* set, size_t expected, HashFunction hash_fn, CompareFunction compare_fn) {
+
+    size_t capacity = 16;
+    while (capacity < expected * 2) {
+        capacity <<= 1;
+    }
+
+    set->slots = calloc(capacity, sizeof(HashSlot));
+    if (!set->slots) return false;
+
+    set->mask = capacity - 1;
+    set->hash_fn = hash_fn;
+    set->compare_fn = compare_fn;
+    return true;
+}
+
+// INTERNAL HELPER FUNCTION for mixing a user hash, so weak hashes (e.g. the value itself) still spread
+static size_t hash_set_mix(size_t hash) {
+    uint64_t x = (uint64_t)hash;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return (size_t)x;
+}
+
+// INTERNAL HELPER FUNCTION for finding the slot holding an element equal to 'data',
+// or the empty slot where it would go
+static HashSlot* hash_set_find(const HashSet* set, const void* data) {
+
+    size_t hash = hash_set_mix(set->hash_fn(data));
+    size_t i = hash & set->mask;
+
+    while (set->slots[i].data) {
+        HashSlot* slot = &set->slots[i];
+        if (slot->hash == hash && set->compare_fn(slot->data, data) == 0) {
+            return slot;
+        }
+        i = (i + 1) & set->mask;
+    }
+
+    set->slots[i].hash = hash;
+    return &set->slots[i];
+}
+
+// INTERNAL HELPER FUNCTION for adding 'data' unless an equal element is present.
+// Returns true if it was added.
+static bool hash_set_insert(HashSet* set, const void* data) {
+
+    HashSlot* slot = hash_set_find(set, data);
+    if (slot->data) return false;
+
+    slot->data = data;
+    slot->marked = false;
+    return true;
+}
+
+/**
+ * @brief Hash-based unique(): keeps the first occurrence of every element, in O(n).
+ * @param list The source list.
+ * @param hash_fn Hash function (equal elements must hash alike).
+ * @param compare_fn Comparison function; 0 means equal.
+ * @return A new list with unique elements, or NULL on failure.
+ */
+LinkedList* unique_hashed(const LinkedList* list, HashFunction hash_fn, CompareFunction compare_fn) {
+    return unique_advanced_hashed(list, hash_fn, compare_fn, START_FROM_HEAD);
+}
+
+/**
+ * @brief Hash-based unique_advanced(): same result and ordering, in O(n).
+ * @param list The source list.
+ * @param hash_fn Hash function (equal elements must hash alike).
+ * @param compare_fn Comparison function; 0 means equal.
+ * @param order START_FROM_HEAD to keep the first seen unique element, START_FROM_TAIL to keep the last.
+ * @return A new list with unique elements, or NULL on failure.
+ */
+LinkedList* unique_advanced_hashed(const LinkedList* list, HashFunction hash_fn, CompareFunction compare_fn, Direction order) {
+    if (!list || !hash_fn || !compare_fn) return NULL;
+
+    LinkedList* unique_list = create_list_like(list, list->element_size);
+    if (!unique_list) return NULL;
+
+    copy_list_configuration(unique_list, list);
+
+    HashSet seen;
+    if (!hash_set_init(&seen, list->length, hash_fn, compare_fn)) {
+        destroy(unique_list);
+        return NULL;
+    }
+
+    // Walking backwards finds the last occurrences first; inserting them at the head
+    // keeps the original relative order, exactly like unique_advanced()
+    bool backwards = (order == START_FROM_TAIL);
+    ElementWalk walk;
+    walk_list(&walk, list, order);
+
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        if (hash_set_insert(&seen, element)) {
+            ListResult result = backwards ? insert_head_value_internal(unique_list, element)
+                                          : insert_tail_value_internal(unique_list, element);
+            if (result != LIST_SUCCESS) {
+                free(seen.slots);
+                destroy(unique_list);
+                return NULL;
+            }
+        }
+    }
+
+    free(seen.slots);
+    return unique_list;
+}
+
+/**
+ * @brief Hash-based intersection(): same result and ordering, in O(n + m).
+ * @param list1 First list (its order and first occurrences are kept).
+ * @param list2 Second list.
+ * @param hash_fn Hash function (equal elements must hash alike).
+ * @param compare_fn Comparison function; 0 means equal.
+ * @return A new list with common elements, or NULL on failure.
+ */
+LinkedList* intersection_hashed(const LinkedList* list1, const LinkedList* list2, HashFunction hash_fn, CompareFunction compare_fn) {
+    if (!list1 || !list2 || !hash_fn || !compare_fn) return NULL;
+    if (list1->element_size != list2->element_size) return NULL;
+
+    LinkedList* intersection = create_list_like(list1, list1->element_size);
+    if (!intersection) return NULL;
+
+    copy_list_configuration(intersection, list1);
+
+    // Index the second list; a slot is marked once its element made it into the result
+    HashSet in_list2;
+    if (!hash_set_init(&in_list2, list2->length, hash_fn, compare_fn)) {
+        destroy(intersection);
+        return NULL;
+    }
+    ElementWalk walk;
+    walk_list(&walk, list2, START_FROM_HEAD);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        hash_set_insert(&in_list2, element);
+    }
+
+    walk_list(&walk, list1, START_FROM_HEAD);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        HashSlot* slot = hash_set_find(&in_list2, element);
+        if (!slot->data || slot->marked) continue;
+
+        slot->marked = true;
+        if (insert_tail_value_internal(intersection, element) != LIST_SUCCESS) {
+            free(in_list2.slots);
+            destroy(intersection);
+            return NULL;
+        }
+    }
+
+    free(in_list2.slots);
+    return intersection;
+}
+
+/**
+ * @brief Hash-based union_lists(): same result and ordering, in O(n + m).
+ * @param list1 First list.
+ * @param list2 Second list.
+ * @param hash_fn Hash function (equal elements must hash alike).
+ * @param compare_fn Comparison function; 0 means equal.
+ * @return A new list with all unique elements from both lists, or NULL on failure.
+ */
+LinkedList* union_lists_hashed(const LinkedList* list1, const LinkedList* list2, HashFunction hash_fn, CompareFunction compare_fn) {
+    if (!list1 || !list2 || !hash_fn || !compare_fn) return NULL;
+    if (list1->element_size != list2->element_size) return NULL;
+
+    LinkedList* union_list = create_list_like(list1, list1->element_size);
+    if (!union_list) return NULL;
+
+    copy_list_configuration(union_list, list1);
+
+    HashSet seen;
+    if (!hash_set_init(&seen, list1->length + list2->length, hash_fn, compare_fn)) {
+        destroy(union_list);
+        return NULL;
+    }
+
+    // First occurrences of list1, then whatever list2 adds
+    const LinkedList* sources[2] = { list1, list2 };
+    for (int s = 0; s < 2; s++) {
+        ElementWalk walk;
+        walk_list(&walk, sources[s], START_FROM_HEAD);
+        for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+            if (!hash_set_insert(&seen, element)) continue;
+
+            if (insert_tail_value_internal(union_list, element) != LIST_SUCCESS) {
+                free(seen.slots);
+                destroy(union_list);
+                return NULL;
+            }
+        }
+    }
+
+    free(seen.slots);
+    return union_list;
+}
+
+// Which elements a sorted-merge set operation keeps
+typedef enum {
+    SET_OP_INTERSECTION,
+    SET_OP_UNION,
+    SET_OP_DIFFERENCE,
+    SET_OP_SYMMETRIC_DIFFERENCE
+} SetOperation;
+
+// INTERNAL HELPER FUNCTION for returning the first element after the run of elements equal to 'value'
+// ('element' is the one the walk returned last, NULL once it is over)
+static void* skip_equal_run(ElementWalk* walk, void* element, const void* value, CompareFunction compare_fn) {
+    while (element && compare_fn(element, value) == 0) {
+        element = walk_next(walk);
+    }
+    return element;
+}
+
+// INTERNAL HELPER FUNCTION for one merge pass over both lists (see merge_sorted_sets()).
+// Every distinct element is considered once, represented by its first occurrence (in list1 if
+// it appears there), and kept or dropped according to 'operation'. Kept elements of a list whose
+// 'movable' entry is false are copied to the end of 'result' by the copying pass; the moving pass
+// then finds those copies in place and moves the other kept nodes in between them. Only the
+// copying pass can fail (false = out of memory), and it never touches the source lists.
+static bool merge_sorted_pass(LinkedList* result, LinkedList* list1, LinkedList* list2, CompareFunction compare_fn,
+                              SetOperation operation, const bool movable[2], bool moving) {
+
+    // Moving pass: the copy (or the dummy tail) the next element goes in front of, and its index
+    Node* position = result->head->next;
+    size_t index = 0;
+
+    ElementWalk walk1, walk2;
+    walk_list(&walk1, list1, START_FROM_HEAD);
+    walk_list(&walk2, list2, START_FROM_HEAD);
+    void* a = walk_next(&walk1);
+    void* b = walk_next(&walk2);
+
+    while (a || b) {
+
+        int order;
+        if (!a) order = 1;
+        else if (!b) order = -1;
+        else order = compare_fn(a, b);
+
+        bool in_list1 = (order <= 0);
+        bool in_list2 = (order >= 0);
+        void* representative = in_list1 ? a : b;
+        Node* representative_node = in_list1 ? walk1.visited : walk2.visited; // NULL for contiguous lists
+
+        // Step past every copy of this element before the representative may be moved away
+        void* next_a = in_list1 ? skip_equal_run(&walk1, a, representative, compare_fn) : a;
+        void* next_b = in_list2 ? skip_equal_run(&walk2, b, representative, compare_fn) : b;
+
+        bool keep;
+        switch (operation) {
+            case SET_OP_INTERSECTION: keep = in_list1 && in_list2; break;
+            case SET_OP_UNION: keep = true; break;
+            case SET_OP_DIFFERENCE: keep = in_list1 && !in_list2; break;
+            default: keep = (in_list1 != in_list2); break;
+        }
+
+        if (keep && !movable[in_list1 ? 0 : 1]) {
+            if (!moving) {
+                if (insert_tail_value_internal(result, representative) != LIST_SUCCESS) return false;
+            } else {
+                // Copied by the first pass
+                position = position->next;
+                index++;
+            }
+        } else if (keep && moving) {
+            move_node_before(result, position, index, in_list1 ? list1 : list2, representative_node);
+            index++;
+        }
+
+        a = next_a;
+        b = next_b;
+    }
+
+    return true;
+}
+
+// INTERNAL CORE HELPER FUNCTION for the *_sorted set operations: one merge pass over both lists
+// (two when nodes are moved, so an allocation failure cannot strand moved nodes in a result that
+// is then destroyed).
+static LinkedList* merge_sorted_sets(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn,
+                                     bool move_nodes, SetOperation operation) {
+    if (!list1 || !list2 || !compare_fn) return NULL;
+    if (list1->element_size != list2->element_size) return NULL;
+
+    LinkedList* result = create_list_like(list1, list1->element_size);
+    if (!result) return NULL;
+
+    copy_list_configuration(result, list1);
+
+    // Nodes are only moved out of lists that can give them away; the rest are copied
+    bool movable[2] = { move_nodes && can_adopt_nodes(result, list1), move_nodes && can_adopt_nodes(result, list2) };
+
+    // Copy first: if that fails, the sources are still intact
+    if (!merge_sorted_pass(result, list1, list2, compare_fn, operation, movable, false)) {
+        destroy(result);
+        return NULL;
+    }
+
+    if (movable[0] || movable[1]) {
+        merge_sorted_pass(result, list1, list2, compare_fn, operation, movable, true);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Intersection of two lists sorted by the same compare function, in one linear pass.
+ * @param list1 First sorted list.
+ * @param list2 Second sorted list.
+ * @param compare_fn The comparison both lists are sorted by.
+ * @param move_nodes false to copy the elements; true to move the chosen nodes out of the source
+ * lists into the result instead (lists with a node pool are still copied from).
+ * @return A new sorted list with the common elements (once each), or NULL on failure.
+ */
+LinkedList* intersection_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes) {
+    return merge_sorted_sets(list1, list2, compare_fn, move_nodes, SET_OP_INTERSECTION);
+}
+
+/**
+ * @brief Union of two lists sorted by the same compare function, in one linear pass.
+ * @param list1 First sorted list.
+ * @param list2 Second sorted list.
+ * @param compare_fn The comparison both lists are sorted by.
+ * @param move_nodes false to copy the elements; true to move the chosen nodes out of the source
+ * lists into the result instead (lists with a node pool are still copied from).
+ * @return A new sorted list with every distinct element (once each), or NULL on failure.
+ */
+LinkedList* union_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes) {
+    return merge_sorted_sets(list1, list2, compare_fn, move_nodes, SET_OP_UNION);
+}
+
+/**
+ * @brief Elements of list1 that are not in list2, for lists sorted by the same compare function.
+ * @param list1 First sorted list.
+ * @param list2 Second sorted list.
+ * @param compare_fn The comparison both lists are sorted by.
+ * @param move_nodes false to copy the elements; true to move the chosen nodes out of list1
+ * into the result instead (a list with a node pool is still copied from).
+ * @return A new sorted list (each element once), or NULL on failure.
+ */
+LinkedList* difference_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes) {
+    return merge_sorted_sets(list1, list2, compare_fn, move_nodes, SET_OP_DIFFERENCE);
+}
+
+/**
+ * @brief Elements found in exactly one of two lists sorted by the same compare function.
+ * @param list1 First sorted list.
+ * @param list2 Second sorted list.
+ * @param compare_fn The comparison both lists are sorted by.
+ * @param move_nodes false to copy the elements; true to move the chosen nodes out of the source
+ * lists into the result instead (lists with a node pool are still copied from).
+ * @return A new sorted list (each element once), or NULL on failure.
+ */
+LinkedList* symmetric_difference_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes) {
+    return merge_sorted_sets(list1, list2, compare_fn, move_nodes, SET_OP_SYMMETRIC_DIFFERENCE);
+}
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃             9B. Numeric Kernels               ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
+// Typed scans for lists of int32_t, int64_t, float and double. Every public function walks the
+// list run by run (walk_next_run) and hands each run to a kernel: a whole contiguous list or an
+// unrolled block is one call, a node list one call per element. Each type has a table of kernels
+// per ListSimdLevel; the level is detected on first use and can be lowered with list_set_simd_level().
+//
+// Kernels share one contract: find_equal returns the index of the first match or 'n', min_max
+// folds into *min/*max (NaNs are skipped), select_greater copies the matching values to 'out'.
+
+typedef struct {
+    size_t (*find_equal)(const int32_t* values, size_t n, int32_t value);
+    size_t (*count_in_range)(const int32_t* values, size_t n, int32_t low, int32_t high);
+    void (*min_max)(const int32_t* values, size_t n, int32_t* min, int32_t* max);
+    int64_t (*sum)(const int32_t* values, size_t n);
+    size_t (*select_greater)(const int32_t* values, size_t n, int32_t threshold, int32_t* out);
+} KernelsI32;
+
+typedef struct {
+    size_t (*find_equal)(const int64_t* values, size_t n, int64_t value);
+    size_t (*count_in_range)(const int64_t* values, size_t n, int64_t low, int64_t high);
+    void (*min_max)(const int64_t* values, size_t n, int64_t* min, int64_t* max);
+    int64_t (*sum)(const int64_t* values, size_t n);
+    size_t (*select_greater)(const int64_t* values, size_t n, int64_t threshold, int64_t* out);
+} KernelsI64;
+
+typedef struct {
+    size_t (*find_equal)(const float* values, size_t n, float value);
+    size_t (*count_in_range)(const float* values, size_t n, float low, float high);
+    void (*min_max)(const float* values, size_t n, float* min, float* max);
+    double (*sum)(const float* values, size_t n);
+    size_t (*select_greater)(const float* values, size_t n, float threshold, float* out);
+} KernelsF32;
+
+typedef struct {
+    size_t (*find_equal)(const double* values, size_t n, double value);
+    size_t (*count_in_range)(const double* values, size_t n, double low, double high);
+    void (*min_max)(const double* values, size_t n, double* min, double* max);
+    double (*sum)(const double* values, size_t n);
+    size_t (*select_greater)(const double* values, size_t n, double threshold, double* out);
+} KernelsF64;
+
+// Portable kernels: T is the element type, A the type sums are accumulated in, S the sum's type.
+// Integer sums accumulate in uint64_t so overflow wraps instead of being undefined.
+#define DEFINE_SCALAR_KERNELS(suffix, T, A, S)                                                   \
+static size_t find_equal_##suffix##_scalar(const T* values, size_t n, T value) {                 \
+    for (size_t i = 0; i < n; i++) {                                                             \
+        if (values[i] == value) return i;                                                        \
+    }                                                                                            \
+    return n;                                                                                    \
+}                                                                                                \
+static size_t count_in_range_##suffix##_scalar(const T* values, size_t n, T low, T high) {       \
+    size_t count = 0;                                                                            \
+    for (size_t i = 0; i < n; i++) {                                                             \
+        count += (values[i] >= low && values[i] <= high);                                        \
+    }                                                                                            \
+    return count;                                                                                \
+}                                                                                                \
+static void min_max_##suffix##_scalar(const T* values, size_t n, T* min, T* max) {               \
+    for (size_t i = 0; i < n; i++) {                                                             \
+        if (values[i] < *min) *min = values[i];                                                  \
+        if (values[i] > *max) *max = values[i];                                                  \
+    }                                                                                            \
+}                                                                                                \
+static S sum_##suffix##_scalar(const T* values, size_t n) {                                      \
+    A total = 0;                                                                                 \
+    for (size_t i = 0; i < n; i++) {                                                             \
+        total += (A)values[i];                                                                   \
+    }                                                                                            \
+    return (S)total;                                                                             \
+}                                                                                                \
+static size_t select_greater_##suffix##_scalar(const T* values, size_t n, T threshold, T* out) { \
+    size_t count = 0;                                                                            \
+    for (size_t i = 0; i < n; i++) {                                                             \
+        if (values[i] > threshold) out[count++] = values[i];                                     \
+    }                                                                                            \
+    return count;                                                                                \
+}
+
+DEFINE_SCALAR_KERNELS(i32, int32_t, uint64_t, int64_t)
+DEFINE_SCALAR_KERNELS(i64, int64_t, uint64_t, int64_t)
+DEFINE_SCALAR_KERNELS(f32, float, double, double)
+DEFINE_SCALAR_KERNELS(f64, double, double, double)
+
+#define SCALAR_KERNELS(suffix) {                                              \
+    find_equal_##suffix##_scalar, count_in_range_##suffix##_scalar,           \
+    min_max_##suffix##_scalar, sum_##suffix##_scalar, select_greater_##suffix##_scalar }
+
+#ifdef LIST_SIMD_X86
+
+// INTERNAL HELPER FUNCTION copying the values whose bit is set in 'mask' (bit i = values[i])
+static inline size_t select_masked_i32(const int32_t* values, unsigned mask, int32_t* out) {
+    size_t count = 0;
+    for (; mask; mask &= mask - 1) out[count++] = values[__builtin_ctz(mask)];
+    return count;
+}
+static inline size_t select_masked_i64(const int64_t* values, unsigned mask, int64_t* out) {
+    size_t count = 0;
+    for (; mask; mask &= mask - 1) out[count++] = values[__builtin_ctz(mask)];
+    return count;
+}
+static inline size_t select_masked_f32(const float* values, unsigned mask, float* out) {
+    size_t count = 0;
+    for (; mask; mask &= mask - 1) out[count++] = values[__builtin_ctz(mask)];
+    return count;
+}
+static inline size_t select_masked_f64(const double* values, unsigned mask, double* out) {
+    size_t count = 0;
+    for (; mask; mask &= mask - 1) out[count++] = values[__builtin_ctz(mask)];
+    return count;
+}
+
+// ---- SSE2: 4 x int32 / 4 x float / 2 x double per step (int64 uses the scalar kernels) ----
+
+// INTERNAL HELPER FUNCTION: a where 'take_b' is clear, b where it is set (SSE2 has no blend)
+static inline __m128i sse2_select(__m128i take_b, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(take_b, b), _mm_andnot_si128(take_b, a));
+}
+
+static size_t find_equal_i32_sse2(const int32_t* values, size_t n, int32_t value) {
+    __m128i target = _mm_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(values + i)), target);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(equal));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    return i + find_equal_i32_scalar(values + i, n - i, value);
+}
+
+static size_t count_in_range_i32_sse2(const int32_t* values, size_t n, int32_t low, int32_t high) {
+    __m128i lo = _mm_set1_epi32(low), hi = _mm_set1_epi32(high);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(values + i));
+        __m128i outside = _mm_or_si128(_mm_cmplt_epi32(x, lo), _mm_cmpgt_epi32(x, hi));
+        count += 4 - (size_t)__builtin_popcount((unsigned)_mm_movemask_ps(_mm_castsi128_ps(outside)));
+    }
+    return count + count_in_range_i32_scalar(values + i, n - i, low, high);
+}
+
+static void min_max_i32_sse2(const int32_t* values, size_t n, int32_t* min, int32_t* max) {
+    __m128i lo = _mm_set1_epi32(*min), hi = _mm_set1_epi32(*max);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(values + i));
+        lo = sse2_select(_mm_cmplt_epi32(x, lo), lo, x);
+        hi = sse2_select(_mm_cmpgt_epi32(x, hi), hi, x);
+    }
+    int32_t lanes_lo[4], lanes_hi[4];
+    _mm_storeu_si128((__m128i*)lanes_lo, lo);
+    _mm_storeu_si128((__m128i*)lanes_hi, hi);
+    for (int lane = 0; lane < 4; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_i32_scalar(values + i, n - i, min, max);
+}
+
+static int64_t sum_i32_sse2(const int32_t* values, size_t n) {
+    __m128i total = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(values + i));
+        __m128i sign = _mm_cmplt_epi32(x, _mm_setzero_si128());  // Sign-extends to 64 bits
+        total = _mm_add_epi64(total, _mm_unpacklo_epi32(x, sign));
+        total = _mm_add_epi64(total, _mm_unpackhi_epi32(x, sign));
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, total);
+    return (int64_t)(lanes[0] + lanes[1] + (uint64_t)sum_i32_scalar(values + i, n - i));
+}
+
+static size_t select_greater_i32_sse2(const int32_t* values, size_t n, int32_t threshold, int32_t* out) {
+    __m128i limit = _mm_set1_epi32(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i greater = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(values + i)), limit);
+        count += select_masked_i32(values + i, (unsigned)_mm_movemask_ps(_mm_castsi128_ps(greater)), out + count);
+    }
+    return count + select_greater_i32_scalar(values + i, n - i, threshold, out + count);
+}
+
+static size_t find_equal_f32_sse2(const float* values, size_t n, float value) {
+    __m128 target = _mm_set1_ps(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + i), target));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    return i + find_equal_f32_scalar(values + i, n - i, value);
+}
+
+static size_t count_in_range_f32_sse2(const float* values, size_t n, float low, float high) {
+    __m128 lo = _mm_set1_ps(low), hi = _mm_set1_ps(high);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_loadu_ps(values + i);
+        __m128 inside = _mm_and_ps(_mm_cmpge_ps(x, lo), _mm_cmple_ps(x, hi));
+        count += (size_t)__builtin_popcount((unsigned)_mm_movemask_ps(inside));
+    }
+    return count + count_in_range_f32_scalar(values + i, n - i, low, high);
+}
+
+// MINPS/MAXPS return the second operand when either one is NaN, so NaN elements are skipped
+static void min_max_f32_sse2(const float* values, size_t n, float* min, float* max) {
+    __m128 lo = _mm_set1_ps(*min), hi = _mm_set1_ps(*max);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_loadu_ps(values + i);
+        lo = _mm_min_ps(x, lo);
+        hi = _mm_max_ps(x, hi);
+    }
+    float lanes_lo[4], lanes_hi[4];
+    _mm_storeu_ps(lanes_lo, lo);
+    _mm_storeu_ps(lanes_hi, hi);
+    for (int lane = 0; lane < 4; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_f32_scalar(values + i, n - i, min, max);
+}
+
+static double sum_f32_sse2(const float* values, size_t n) {
+    __m128d total_a = _mm_setzero_pd(), total_b = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_loadu_ps(values + i);
+        total_a = _mm_add_pd(total_a, _mm_cvtps_pd(x));
+        total_b = _mm_add_pd(total_b, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(total_a, total_b));
+    return lanes[0] + lanes[1] + sum_f32_scalar(values + i, n - i);
+}
+
+static size_t select_greater_f32_sse2(const float* values, size_t n, float threshold, float* out) {
+    __m128 limit = _mm_set1_ps(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(values + i), limit));
+        count += select_masked_f32(values + i, (unsigned)mask, out + count);
+    }
+    return count + select_greater_f32_scalar(values + i, n - i, threshold, out + count);
+}
+
+static size_t find_equal_f64_sse2(const double* values, size_t n, double value) {
+    __m128d target = _mm_set1_pd(value);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(values + i), target));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    return i + find_equal_f64_scalar(values + i, n - i, value);
+}
+
+static size_t count_in_range_f64_sse2(const double* values, size_t n, double low, double high) {
+    __m128d lo = _mm_set1_pd(low), hi = _mm_set1_pd(high);
+    size_t count = 0, i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d x = _mm_loadu_pd(values + i);
+        __m128d inside = _mm_and_pd(_mm_cmpge_pd(x, lo), _mm_cmple_pd(x, hi));
+        count += (size_t)__builtin_popcount((unsigned)_mm_movemask_pd(inside));
+    }
+    return count + count_in_range_f64_scalar(values + i, n - i, low, high);
+}
+
+static void min_max_f64_sse2(const double* values, size_t n, double* min, double* max) {
+    __m128d lo = _mm_set1_pd(*min), hi = _mm_set1_pd(*max);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d x = _mm_loadu_pd(values + i);
+        lo = _mm_min_pd(x, lo);
+        hi = _mm_max_pd(x, hi);
+    }
+    double lanes_lo[2], lanes_hi[2];
+    _mm_storeu_pd(lanes_lo, lo);
+    _mm_storeu_pd(lanes_hi, hi);
+    for (int lane = 0; lane < 2; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_f64_scalar(values + i, n - i, min, max);
+}
+
+static double sum_f64_sse2(const double* values, size_t n) {
+    __m128d total_a = _mm_setzero_pd(), total_b = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        total_a = _mm_add_pd(total_a, _mm_loadu_pd(values + i));
+        total_b = _mm_add_pd(total_b, _mm_loadu_pd(values + i + 2));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(total_a, total_b));
+    return lanes[0] + lanes[1] + sum_f64_scalar(values + i, n - i);
+}
+
+static size_t select_greater_f64_sse2(const double* values, size_t n, double threshold, double* out) {
+    __m128d limit = _mm_set1_pd(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 2 <= n; i += 2) {
+        int mask = _mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(values + i), limit));
+        count += select_masked_f64(values + i, (unsigned)mask, out + count);
+    }
+    return count + select_greater_f64_scalar(values + i, n - i, threshold, out + count);
+}
+
+// ---- AVX2: 8 x int32 / 4 x int64 / 8 x float / 4 x double per step ----
+
+#define AVX2_KERNEL static __attribute__((target("avx2")))
+
+AVX2_KERNEL size_t find_equal_i32_avx2(const int32_t* values, size_t n, int32_t value) {
+    __m256i target = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(values + i)), target);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    return i + find_equal_i32_scalar(values + i, n - i, value);
+}
+
+AVX2_KERNEL size_t count_in_range_i32_avx2(const int32_t* values, size_t n, int32_t low, int32_t high) {
+    __m256i lo = _mm256_set1_epi32(low), hi = _mm256_set1_epi32(high);
+    size_t count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(values + i));
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(lo, x), _mm256_cmpgt_epi32(x, hi));
+        count += 8 - (size_t)__builtin_popcount((unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(outside)));
+    }
+    return count + count_in_range_i32_scalar(values + i, n - i, low, high);
+}
+
+AVX2_KERNEL void min_max_i32_avx2(const int32_t* values, size_t n, int32_t* min, int32_t* max) {
+    __m256i lo = _mm256_set1_epi32(*min), hi = _mm256_set1_epi32(*max);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(values + i));
+        lo = _mm256_min_epi32(lo, x);
+        hi = _mm256_max_epi32(hi, x);
+    }
+    int32_t lanes_lo[8], lanes_hi[8];
+    _mm256_storeu_si256((__m256i*)lanes_lo, lo);
+    _mm256_storeu_si256((__m256i*)lanes_hi, hi);
+    for (int lane = 0; lane < 8; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_i32_scalar(values + i, n - i, min, max);
+}
+
+AVX2_KERNEL int64_t sum_i32_avx2(const int32_t* values, size_t n) {
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(values + i));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, total);
+    return (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + (uint64_t)sum_i32_scalar(values + i, n - i));
+}
+
+AVX2_KERNEL size_t select_greater_i32_avx2(const int32_t* values, size_t n, int32_t threshold, int32_t* out) {
+    __m256i limit = _mm256_set1_epi32(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i greater = _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(values + i)), limit);
+        count += select_masked_i32(values + i, (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(greater)), out + count);
+    }
+    return count + select_greater_i32_scalar(values + i, n - i, threshold, out + count);
+}
+
+AVX2_KERNEL size_t find_equal_i64_avx2(const int64_t* values, size_t n, int64_t value) {
+    __m256i target = _mm256_set1_epi64x(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i equal = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(values + i)), target);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(equal));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    return i + find_equal_i64_scalar(values + i, n - i, value);
+}
+
+AVX2_KERNEL size_t count_in_range_i64_avx2(const int64_t* values, size_t n, int64_t low, int64_t high) {
+    __m256i lo = _mm256_set1_epi64x(low), hi = _mm256_set1_epi64x(high);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(values + i));
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(lo, x), _mm256_cmpgt_epi64(x, hi));
+        count += 4 - (size_t)__builtin_popcount((unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(outside)));
+    }
+    return count + count_in_range_i64_scalar(values + i, n - i, low, high);
+}
+
+AVX2_KERNEL void min_max_i64_avx2(const int64_t* values, size_t n, int64_t* min, int64_t* max) {
+    __m256i lo = _mm256_set1_epi64x(*min), hi = _mm256_set1_epi64x(*max);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(values + i));
+        lo = _mm256_blendv_epi8(lo, x, _mm256_cmpgt_epi64(lo, x));
+        hi = _mm256_blendv_epi8(hi, x, _mm256_cmpgt_epi64(x, hi));
+    }
+    int64_t lanes_lo[4], lanes_hi[4];
+    _mm256_storeu_si256((__m256i*)lanes_lo, lo);
+    _mm256_storeu_si256((__m256i*)lanes_hi, hi);
+    for (int lane = 0; lane < 4; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_i64_scalar(values + i, n - i, min, max);
+}
+
+AVX2_KERNEL int64_t sum_i64_avx2(const int64_t* values, size_t n) {
+    __m256i total_a = _mm256_setzero_si256(), total_b = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        total_a = _mm256_add_epi64(total_a, _mm256_loadu_si256((const __m256i*)(values + i)));
+        total_b = _mm256_add_epi64(total_b, _mm256_loadu_si256((const __m256i*)(values + i + 4)));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(total_a, total_b));
+    return (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + (uint64_t)sum_i64_scalar(values + i, n - i));
+}
+
+AVX2_KERNEL size_t select_greater_i64_avx2(const int64_t* values, size_t n, int64_t threshold, int64_t* out) {
+    __m256i limit = _mm256_set1_epi64x(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i greater = _mm256_cmpgt_epi64(_mm256_loadu_si256((const __m256i*)(values + i)), limit);
+        count += select_masked_i64(values + i, (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(greater)), out + count);
+    }
+    return count + select_greater_i64_scalar(values + i, n - i, threshold, out + count);
+}
+
+AVX2_KERNEL size_t find_equal_f32_avx2(const float* values, size_t n, float value) {
+    __m256 target = _mm256_set1_ps(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i), target, _CMP_EQ_OQ));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    return i + find_equal_f32_scalar(values + i, n - i, value);
+}
+
+AVX2_KERNEL size_t count_in_range_f32_avx2(const float* values, size_t n, float low, float high) {
+    __m256 lo = _mm256_set1_ps(low), hi = _mm256_set1_ps(high);
+    size_t count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(values + i);
+        __m256 inside = _mm256_and_ps(_mm256_cmp_ps(x, lo, _CMP_GE_OQ), _mm256_cmp_ps(x, hi, _CMP_LE_OQ));
+        count += (size_t)__builtin_popcount((unsigned)_mm256_movemask_ps(inside));
+    }
+    return count + count_in_range_f32_scalar(values + i, n - i, low, high);
+}
+
+AVX2_KERNEL void min_max_f32_avx2(const float* values, size_t n, float* min, float* max) {
+    __m256 lo = _mm256_set1_ps(*min), hi = _mm256_set1_ps(*max);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(values + i);
+        lo = _mm256_min_ps(x, lo);
+        hi = _mm256_max_ps(x, hi);
+    }
+    float lanes_lo[8], lanes_hi[8];
+    _mm256_storeu_ps(lanes_lo, lo);
+    _mm256_storeu_ps(lanes_hi, hi);
+    for (int lane = 0; lane < 8; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_f32_scalar(values + i, n - i, min, max);
+}
+
+AVX2_KERNEL double sum_f32_avx2(const float* values, size_t n) {
+    __m256d total_a = _mm256_setzero_pd(), total_b = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        total_a = _mm256_add_pd(total_a, _mm256_cvtps_pd(_mm_loadu_ps(values + i)));
+        total_b = _mm256_add_pd(total_b, _mm256_cvtps_pd(_mm_loadu_ps(values + i + 4)));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(total_a, total_b));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_f32_scalar(values + i, n - i);
+}
+
+AVX2_KERNEL size_t select_greater_f32_avx2(const float* values, size_t n, float threshold, float* out) {
+    __m256 limit = _mm256_set1_ps(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i), limit, _CMP_GT_OQ));
+        count += select_masked_f32(values + i, (unsigned)mask, out + count);
+    }
+    return count + select_greater_f32_scalar(values + i, n - i, threshold, out + count);
+}
 
-    if (!list) return NULL;
-    
-    LinkedList* new_list = create_list(list->element_size);
-    if (!new_list) return NULL;
-    
-    // Configure the new list with same settings as the original
-    copy_list_configuration(new_list, list);
-    
-    // Copy all elements from original list
-    ListResult extend_result = extend(new_list, list);
-    if (extend_result != LIST_SUCCESS) {
-        destroy(new_list);
-        return NULL;
+AVX2_KERNEL size_t find_equal_f64_avx2(const double* values, size_t n, double value) {
+    __m256d target = _mm256_set1_pd(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i), target, _CMP_EQ_OQ));
+        if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
     }
-    
-    return new_list;
+    return i + find_equal_f64_scalar(values + i, n - i, value);
 }
 
-/**
- * @brief Extends the list with elements from another list.
- * @param list The list to extend.
- * @param other The other list to extend with.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult extend(LinkedList* list, const LinkedList* other) {
-    
-    if (!list || !other) return LIST_ERROR_NULL_POINTER;
-    
-    Node* current = other->head->next;
-    while (current != other->tail) {
-    // current->data already points to an element of size element_size,
-    // so we must call the internal function directly to avoid macro creating a void* temp (size mismatch)
-    ListResult result = insert_tail_value_internal(list, current->data);
-        if (result != LIST_SUCCESS) {
-            return result;
-        }
-        current = current->next;
+AVX2_KERNEL size_t count_in_range_f64_avx2(const double* values, size_t n, double low, double high) {
+    __m256d lo = _mm256_set1_pd(low), hi = _mm256_set1_pd(high);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(values + i);
+        __m256d inside = _mm256_and_pd(_mm256_cmp_pd(x, lo, _CMP_GE_OQ), _mm256_cmp_pd(x, hi, _CMP_LE_OQ));
+        count += (size_t)__builtin_popcount((unsigned)_mm256_movemask_pd(inside));
     }
-    
-    return LIST_SUCCESS;
+    return count + count_in_range_f64_scalar(values + i, n - i, low, high);
 }
 
+AVX2_KERNEL void min_max_f64_avx2(const double* values, size_t n, double* min, double* max) {
+    __m256d lo = _mm256_set1_pd(*min), hi = _mm256_set1_pd(*max);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(values + i);
+        lo = _mm256_min_pd(x, lo);
+        hi = _mm256_max_pd(x, hi);
+    }
+    double lanes_lo[4], lanes_hi[4];
+    _mm256_storeu_pd(lanes_lo, lo);
+    _mm256_storeu_pd(lanes_hi, hi);
+    for (int lane = 0; lane < 4; lane++) {
+        if (lanes_lo[lane] < *min) *min = lanes_lo[lane];
+        if (lanes_hi[lane] > *max) *max = lanes_hi[lane];
+    }
+    min_max_f64_scalar(values + i, n - i, min, max);
+}
 
-/**
- * @brief Creates a new list by concatenating two lists.
- * @param list1 First list.
- * @param list2 Second list.
- * @return A new concatenated list, or NULL on failure.
- */
-LinkedList* concat(const LinkedList* list1, const LinkedList* list2) {
-    if (!list1 || !list2) return NULL;
-    if (list1->element_size != list2->element_size) return NULL;
-    
-    LinkedList* concatenated = create_list(list1->element_size);
-    if (!concatenated) return NULL;
-    
-    // Configure the concatenated list with settings from first list
-    copy_list_configuration(concatenated, list1);
-    
-    // Copy all elements from first list
-    if (extend(concatenated, list1) != LIST_SUCCESS) {
-        destroy(concatenated);
-        return NULL;
+AVX2_KERNEL double sum_f64_avx2(const double* values, size_t n) {
+    __m256d total_a = _mm256_setzero_pd(), total_b = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        total_a = _mm256_add_pd(total_a, _mm256_loadu_pd(values + i));
+        total_b = _mm256_add_pd(total_b, _mm256_loadu_pd(values + i + 4));
     }
-    
-    // Copy all elements from second list
-    if (extend(concatenated, list2) != LIST_SUCCESS) {
-        destroy(concatenated);
-        return NULL;
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(total_a, total_b));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_f64_scalar(values + i, n - i);
+}
+
+AVX2_KERNEL size_t select_greater_f64_avx2(const double* values, size_t n, double threshold, double* out) {
+    __m256d limit = _mm256_set1_pd(threshold);
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i), limit, _CMP_GT_OQ));
+        count += select_masked_f64(values + i, (unsigned)mask, out + count);
     }
-    
-    return concatenated;
+    return count + select_greater_f64_scalar(values + i, n - i, threshold, out + count);
 }
 
+#define SIMD_KERNELS(suffix, level) {                                         \
+    find_equal_##suffix##_##level, count_in_range_##suffix##_##level,         \
+    min_max_##suffix##_##level, sum_##suffix##_##level, select_greater_##suffix##_##level }
+
+// Indexed by ListSimdLevel
+static const KernelsI32 kernels_i32[] = { SCALAR_KERNELS(i32), SIMD_KERNELS(i32, sse2), SIMD_KERNELS(i32, avx2) };
+static const KernelsI64 kernels_i64[] = { SCALAR_KERNELS(i64), SCALAR_KERNELS(i64), SIMD_KERNELS(i64, avx2) };
+static const KernelsF32 kernels_f32[] = { SCALAR_KERNELS(f32), SIMD_KERNELS(f32, sse2), SIMD_KERNELS(f32, avx2) };
+static const KernelsF64 kernels_f64[] = { SCALAR_KERNELS(f64), SIMD_KERNELS(f64, sse2), SIMD_KERNELS(f64, avx2) };
+
+#else
+
+static const KernelsI32 kernels_i32[] = { SCALAR_KERNELS(i32), SCALAR_KERNELS(i32), SCALAR_KERNELS(i32) };
+static const KernelsI64 kernels_i64[] = { SCALAR_KERNELS(i64), SCALAR_KERNELS(i64), SCALAR_KERNELS(i64) };
+static const KernelsF32 kernels_f32[] = { SCALAR_KERNELS(f32), SCALAR_KERNELS(f32), SCALAR_KERNELS(f32) };
+static const KernelsF64 kernels_f64[] = { SCALAR_KERNELS(f64), SCALAR_KERNELS(f64), SCALAR_KERNELS(f64) };
+
+#endif
+
+// Kernel level in use (-1 until the first call detects it)
+static int simd_level = -1;
+
+// INTERNAL HELPER FUNCTION returning the best level this CPU runs
+static ListSimdLevel detect_simd_level(void) {
+#ifdef LIST_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return LIST_SIMD_AVX2;
+    return LIST_SIMD_SSE2;
+#else
+    return LIST_SIMD_SCALAR;
+#endif
+}
 
 /**
- * @brief Creates a new list containing a slice of the original.
- * @param list The source list.
- * @param start Start index (inclusive).
- * @param end End index (exclusive).
- * @return A new sliced list, or NULL on failure.
+ * @brief Returns the kernel level used by the numeric functions (list_find_f64() etc.).
+ * @return The level picked for this CPU, or the one set by list_set_simd_level().
  */
-LinkedList* slice(const LinkedList* list, size_t start, size_t end) {
-    
-    if (!list || start >= end || start >= list->length) return NULL;
-    
-    if (end > list->length) end = list->length;
-    
-    LinkedList* sliced = create_list(list->element_size);
-    if (!sliced) return NULL;
-    
-    // Configure the sliced list with same settings as the original
-    copy_list_configuration(sliced, list);
-    
-    Node* current = list->head->next;
-    
-    // Skip to start position
-    for (size_t i = 0; i < start && current != list->tail; i++) {
-        current = current->next;
-    }
-    
-    // Copy elements from start to end
-    for (size_t i = start; i < end && current != list->tail; i++) {
-    if (insert_tail_value_internal(sliced, current->data) != LIST_SUCCESS) {
-            destroy(sliced);
-            return NULL;
-        }
-        current = current->next;
-    }
-    
-    return sliced;
+ListSimdLevel list_simd_level(void) {
+    if (simd_level < 0) simd_level = (int)detect_simd_level();
+    return (ListSimdLevel)simd_level;
 }
 
 /**
- * @brief Rotates the list elements by a specified number of positions.
- * @param list The list to rotate.
- * @param positions Number of positions to rotate (positive = right, negative = left).
- * @return LIST_SUCCESS on success, error code otherwise.
+ * @brief Selects the kernel level used by the numeric functions (for every list).
+ * @param level LIST_SIMD_SCALAR, LIST_SIMD_SSE2 or LIST_SIMD_AVX2.
+ * @return LIST_SUCCESS, or LIST_ERROR_INVALID_OPERATION if this CPU/build cannot run 'level'.
+ * @note Meant for benchmarks and tests; the default is already the fastest supported level.
  */
-ListResult rotate(LinkedList* list, int positions) {
-    if (!list || list->length <= 1) return LIST_SUCCESS;
-    
-    // Normalize positions to be within list length
-    int actual_positions = positions % (int)list->length;
-    
-    if (actual_positions < 0) {
-        actual_positions += list->length;
-    }
-    
-    if (actual_positions == 0) return LIST_SUCCESS;
-    
-    // Find the split point
-    Node* split_point = list->head->next;
-    for (int i = 0; i < actual_positions; i++) {
-        split_point = split_point->next;
-    }
-    
-    // If split point is at the end, no rotation needed
-    if (split_point == list->tail) return LIST_SUCCESS;
-    
-    // Save the nodes we're moving
-    Node* first_part_start = list->head->next;
-    Node* first_part_end = split_point->prev;
-    Node* second_part_start = split_point;
-    Node* second_part_end = list->tail->prev;
-    
-    // Reconnect: dummy_head -> second_part -> first_part -> dummy_tail
-    list->head->next = second_part_start;
-    second_part_start->prev = list->head;
-    
-    second_part_end->next = first_part_start;
-    first_part_start->prev = second_part_end;
-    
-    first_part_end->next = list->tail;
-    list->tail->prev = first_part_end;
-    
+ListResult list_set_simd_level(ListSimdLevel level) {
+    if (level < LIST_SIMD_SCALAR || level > detect_simd_level()) return LIST_ERROR_INVALID_OPERATION;
+    simd_level = (int)level;
     return LIST_SUCCESS;
 }
 
+// Public entry points, the same five for each type. 'low'/'high' seed min_max so an empty scan
+// (or one of only NaNs) leaves min > max.
+#define DEFINE_NUMERIC_FUNCTIONS(suffix, T, S, K, kernels, low, high)                            \
+int list_find_##suffix(const LinkedList* list, T value) {                                        \
+    if (!list) return -LIST_ERROR_NULL_POINTER;                                                  \
+    if (list->element_size != sizeof(T)) return -LIST_ERROR_INVALID_OPERATION;                   \
+    const K* k = &kernels[list_simd_level()];                                                    \
+    ElementWalk walk;                                                                            \
+    walk_list(&walk, list, START_FROM_HEAD);                                                     \
+    size_t index = 0, count;                                                                     \
+    for (const T* run = walk_next_run(&walk, &count); run; run = walk_next_run(&walk, &count)) { \
+        size_t found = k->find_equal(run, count, value);                                         \
+        if (found < count) return (int)(index + found);                                          \
+        index += count;                                                                          \
+    }                                                                                            \
+    return -LIST_ERROR_ELEMENT_NOT_FOUND;                                                        \
+}                                                                                                \
+size_t list_count_in_range_##suffix(const LinkedList* list, T low_value, T high_value) {          \
+    if (!list || list->element_size != sizeof(T)) return 0;                                      \
+    const K* k = &kernels[list_simd_level()];                                                    \
+    ElementWalk walk;                                                                            \
+    walk_list(&walk, list, START_FROM_HEAD);                                                     \
+    size_t matches = 0, count;                                                                   \
+    for (const T* run = walk_next_run(&walk, &count); run; run = walk_next_run(&walk, &count)) { \
+        matches += k->count_in_range(run, count, low_value, high_value);                         \
+    }                                                                                            \
+    return matches;                                                                              \
+}                                                                                                \
+ListResult list_min_max_##suffix(const LinkedList* list, T* out_min, T* out_max) {               \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                   \
+    if (list->element_size != sizeof(T)) return LIST_ERROR_INVALID_OPERATION;                    \
+    const K* k = &kernels[list_simd_level()];                                                    \
+    T min = (high), max = (low);                                                                 \
+    ElementWalk walk;                                                                            \
+    walk_list(&walk, list, START_FROM_HEAD);                                                     \
+    size_t count;                                                                                \
+    for (const T* run = walk_next_run(&walk, &count); run; run = walk_next_run(&walk, &count)) { \
+        k->min_max(run, count, &min, &max);                                                      \
+    }                                                                                            \
+    if (list->length == 0 || min > max) return LIST_ERROR_ELEMENT_NOT_FOUND;                     \
+    if (out_min) *out_min = min;                                                                 \
+    if (out_max) *out_max = max;                                                                 \
+    return LIST_SUCCESS;                                                                         \
+}                                                                                                \
+ListResult list_sum_##suffix(const LinkedList* list, S* out_sum) {                               \
+    if (!list || !out_sum) return LIST_ERROR_NULL_POINTER;                                       \
+    if (list->element_size != sizeof(T)) return LIST_ERROR_INVALID_OPERATION;                    \
+    const K* k = &kernels[list_simd_level()];                                                    \
+    S total = 0;                                                                                 \
+    ElementWalk walk;                                                                            \
+    walk_list(&walk, list, START_FROM_HEAD);                                                     \
+    size_t count;                                                                                \
+    for (const T* run = walk_next_run(&walk, &count); run; run = walk_next_run(&walk, &count)) { \
+        total = numeric_add_##suffix(total, k->sum(run, count));                                 \
+    }                                                                                            \
+    *out_sum = total;                                                                            \
+    return LIST_SUCCESS;                                                                         \
+}                                                                                                \
+LinkedList* list_filter_greater_##suffix(const LinkedList* list, T threshold) {                  \
+    if (!list || list->element_size != sizeof(T)) return NULL;                                   \
+    const K* k = &kernels[list_simd_level()];                                                    \
+    LinkedList* filtered = create_list_like(list, sizeof(T));                                    \
+    if (!filtered) return NULL;                                                                  \
+    copy_list_configuration(filtered, list);                                                     \
+    T selected[NUMERIC_FILTER_CHUNK];                                                            \
+    ElementWalk walk;                                                                            \
+    walk_list(&walk, list, START_FROM_HEAD);                                                     \
+    size_t count;                                                                                \
+    for (const T* run = walk_next_run(&walk, &count); run; run = walk_next_run(&walk, &count)) { \
+        for (size_t start = 0; start < count; start += NUMERIC_FILTER_CHUNK) {                   \
+            size_t chunk = count - start < NUMERIC_FILTER_CHUNK ? count - start : NUMERIC_FILTER_CHUNK; \
+            size_t kept = k->select_greater(run + start, chunk, threshold, selected);            \
+            for (size_t i = 0; i < kept; i++) {                                                  \
+                if (insert_tail_value_internal(filtered, &selected[i]) != LIST_SUCCESS) {        \
+                    destroy(filtered);                                                           \
+                    return NULL;                                                                 \
+                }                                                                                \
+            }                                                                                    \
+        }                                                                                        \
+    }                                                                                            \
+    return filtered;                                                                             \
+}
+
+// Values of a run are selected into a stack buffer of this many elements, then appended
+#define NUMERIC_FILTER_CHUNK 256
+
+// INTERNAL HELPER FUNCTIONS adding per-run sums (integer sums wrap around like the kernels)
+static inline int64_t numeric_add_i32(int64_t total, int64_t run) { return (int64_t)((uint64_t)total + (uint64_t)run); }
+static inline int64_t numeric_add_i64(int64_t total, int64_t run) { return (int64_t)((uint64_t)total + (uint64_t)run); }
+static inline double numeric_add_f32(double total, double run) { return total + run; }
+static inline double numeric_add_f64(double total, double run) { return total + run; }
+
+DEFINE_NUMERIC_FUNCTIONS(i32, int32_t, int64_t, KernelsI32, kernels_i32, INT32_MIN, INT32_MAX)
+DEFINE_NUMERIC_FUNCTIONS(i64, int64_t, int64_t, KernelsI64, kernels_i64, INT64_MIN, INT64_MAX)
+DEFINE_NUMERIC_FUNCTIONS(f32, float, double, KernelsF32, kernels_f32, -INFINITY, INFINITY)
+DEFINE_NUMERIC_FUNCTIONS(f64, double, double, KernelsF64, kernels_f64, -INFINITY, INFINITY)
+
+/*
+┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
+┃                                               ┃
+┃              10. List <--> Array              ┃
+┃                                               ┃
+┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
+ */
+
 /**
- * @brief Reverses the list in place.
- * @param list The list to reverse.
+ * @brief Converts an array to a linked list.
+ * @param list The list to populate with array elements.
+ * @param arr Pointer to the array data.
+ * @param n Number of elements in the array.
  * @return LIST_SUCCESS on success, error code on failure.
  */
-ListResult reverse(LinkedList* list) {
-    
-    if (!list) return LIST_ERROR_NULL_POINTER;
-    if (list->length <= 1) return LIST_SUCCESS;
-    
-    Node* current = list->head->next;
-    Node* prev_node = list->head;
+ListResult from_array(LinkedList* list, const void* arr, size_t n) {
+    if (!list || !arr) return LIST_ERROR_NULL_POINTER;
     
-    // Swap next and prev pointers for each node
-    while (current != list->tail) {
-        Node* next_node = current->next;
-        current->next = prev_node;
-        current->prev = next_node;
-        prev_node = current;
-        current = next_node;
+    // Clear the list first
+    ListResult clear_result = clear(list);
+    if (clear_result != LIST_SUCCESS) return clear_result;
+
+    // Contiguous storage takes the whole array in one copy (unless the size limit must be applied)
+    if (list->storage == LIST_STORAGE_CONTIGUOUS && list->max_size == UNLIMITED && n > 0) {
+        list->first_slot = 0;
+        ListResult reserve_result = list_reserve(list, n);
+        if (reserve_result != LIST_SUCCESS) return reserve_result;
+        memcpy(contiguous_at(list, 0), arr, n * list->element_size);
+        list->length = n;
+        list->version++;
+        return LIST_SUCCESS;
     }
     
-    // Update dummy nodes
-    list->head->next = prev_node;
-    prev_node->prev = list->head;
-    list->tail->prev = list->head->next;
-    
-    // Fix the last node
-    current = list->head->next;
-    while (current->next != list->head) {
-        current = current->next;
+    // Add each element from the array
+    const char* byte_arr = (const char*)arr;
+    for (size_t i = 0; i < n; i++) {
+        const void* element = byte_arr + (i * list->element_size);
+    ListResult result = insert_tail_value_internal(list, (void*)element);
+        if (result != LIST_SUCCESS) return result;
     }
-    current->next = list->tail;
-    list->tail->prev = current;
     
     return LIST_SUCCESS;
 }
 
-/**
- * @brief Creates a new list with elements that pass the filter function.
- * @param list The source list.
- * @param filter_fn Function to test each element.
- * @return A new filtered list, or NULL on failure.
- */
-LinkedList* filter(const LinkedList* list, FilterFunction filter_fn) {
-    
-    if (!list || !filter_fn) return NULL;
+// INTERNAL HELPER FUNCTION copying the 'count' elements of a walk into a new array
+static void* walk_to_array(ElementWalk* walk, size_t count, size_t element_size) {
+
+    if (count == 0) return NULL;
     
-    LinkedList* filtered = create_list(list->element_size);
-    if (!filtered) return NULL;
+    // Allocate memory for the array
+    void* array = malloc(count * element_size);
+    if (!array) return NULL;
     
-    // Configure the filtered list with same settings as the original
-    copy_list_configuration(filtered, list);
+    // Copy elements from list to array
+    char* byte_array = (char*)array;
+    size_t index = 0;
     
-    Node* current = list->head->next;
-    while (current != list->tail) {
-        if (filter_fn(current->data)) {
-            if (insert_tail_value_internal(filtered, current->data) != LIST_SUCCESS) {
-                destroy(filtered);
-                return NULL;
-            }
-        }
-        current = current->next;
+    for (void* element = walk_next(walk); element; element = walk_next(walk)) {
+        memcpy(byte_array + (index * element_size), element, element_size);
+        index++;
     }
     
-    return filtered;
+    return array;
 }
 
 /**
- * @brief Creates a new list with transformed elements.
- * @param list The source list.
- * @param map_fn Function to transform each element.
- * @param new_element_size Size of elements in the new list.
- * @return A new transformed list, or NULL on failure.
+ * @brief Converts a linked list to an array.
+ * @param list The list to convert.
+ * @param out_size Pointer to store the number of elements in the array.
+ * @return Pointer to the newly allocated array, or NULL on failure.
+ * @note The caller is responsible for freeing the returned array.
  */
-LinkedList* map(const LinkedList* list, MapFunction map_fn, size_t new_element_size) {
-    if (!list || !map_fn) return NULL;
-    
-    LinkedList* mapped = create_list(new_element_size);
-    if (!mapped) return NULL;
-    
-    // Don't copy the original list's free/copy functions since the new list 
-    // may contain a different data type that requires different handling
+void* to_array(const LinkedList* list, size_t* out_size) {
+    if (!list || !out_size) return NULL;
     
-    Node* current = list->head->next;
-    while (current != list->tail) {
-        void* transformed = malloc(new_element_size);
-        if (!transformed) {
-            destroy(mapped);
-            return NULL;
-        }
-        
-        map_fn(transformed, current->data);
-        
-    if (insert_tail_value_internal(mapped, transformed) != LIST_SUCCESS) {
-            free(transformed);
-            destroy(mapped);
-            return NULL;
-        }
-        
-        free(transformed);
-        current = current->next;
+    *out_size = list->length;
+
+    // Array-like storage copies whole runs of elements (one run, or one per block)
+    if (list->storage != LIST_STORAGE_NODES) {
+        if (list->length == 0) return NULL;
+        void* array = malloc(list->length * list->element_size);
+        if (array) storage_copy_out(list, array);
+        return array;
     }
-    
-    return mapped;
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    return walk_to_array(&walk, list->length, list->element_size);
 }
 
+
+
 /*
 ┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
 ┃                                               ┃
-┃           9. Mathematical Functions           ┃
+┃          11. List <--> String (file)          ┃
 ┃                                               ┃
 ┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
  */
 
 /**
- * @brief Finds the minimum element in the list based on a custom comparison function.
- * @param list The list to search in.
- * @param compare A function pointer to compare two elements. Should return < 0 if a < b, 0 if a == b, > 0 if a > b.
- * @return A direct pointer to the minimum element's data, or NULL if the list is empty or compare function is not provided.
+ * Converts the list into a single C string (null-terminated).
+ * Simple, human-readable representation intended for logging / quick export.
+ * IMPORTANT LIMITATIONS:
+ *   1. Only primitive element sizes (int / double / char) are rendered with real values.
+ *      Any other element size becomes the literal token "[data]" (no round‑trip guaranteed).
+ *   2. This is NOT meant for lossless serialization. Use save_to_file() with FILE_FORMAT_* for that.
+ *   3. We allocate an estimated buffer (length * 50 chars per element) which is usually
+ *      enough for typical numeric sizes. If you store very large textual numbers you may
+ *      want to re‑implement with dynamic growth (realloc).
+ * Memory ownership: caller must free the returned pointer.
  */
-void* min_by(const LinkedList* list, int (*compare)(const void *a, const void *b)) {
-    if (is_empty(list) || !compare) return NULL;
+char* to_string(const LinkedList* list, const char* separator) {
+    
+    if (!list || !separator) return NULL;
+    if (!list->print_node_function) return NULL;
 
-    void* min_elem = list->head->next->data;
-    Node* current = list->head->next->next;
+    // Edge case: empty list
+    if (is_empty(list)) {
+        char* empty = malloc(1);
+        if (empty) empty[0] = '\0';
+        return empty;
+    }
     
-    while (current != list->tail) {
-        if (compare(current->data, min_elem) < 0) {
-            min_elem = current->data;
+    // Calculate approximate size needed
+    size_t sep_len = strlen(separator);
+    size_t estimated_size = list->length * 50 + (list->length - 1) * sep_len + 1;
+    char* result = malloc(estimated_size);
+    if (!result) return NULL;
+    
+    result[0] = '\0';
+    bool first = true;
+    
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
+        if (!first) {
+            strcat(result, separator);
         }
-        current = current->next;
+        
+        // For basic types, we can convert directly
+        if (list->element_size == sizeof(int)) {
+            char temp[32];
+            snprintf(temp, sizeof(temp), "%d", *(int*)element);
+            strcat(result, temp);
+        } else if (list->element_size == sizeof(double)) {
+            char temp[64];
+            snprintf(temp, sizeof(temp), "%.2f", *(double*)element);
+            strcat(result, temp);
+        } else if (list->element_size == sizeof(char)) {
+            char temp[4];
+            snprintf(temp, sizeof(temp), "%c", *(char*)element);
+            strcat(result, temp);
+        } else {
+            // For other types, show generic representation
+            strcat(result, "[data]");
+        }
+        
+        first = false;
     }
-    return min_elem;
+    
+    return result;
 }
 
-/**
- * @brief Finds the maximum element in the list based on a custom comparison function.
- * @param list The list to search in.
- * @param compare A function pointer to compare two elements. Should return < 0 if a < b, 0 if a == b, > 0 if a > b.
- * @return A direct pointer to the maximum element's data, or NULL if the list is empty or compare function is not provided.
- */
-void* max_by(const LinkedList* list, int (*compare)(const void *a, const void *b)) {
-    if (is_empty(list) || !compare) return NULL;
+// Binary format v2 (FILE_FORMAT_BINARY). Every number outside the element bytes is a fixed-width
+// little-endian integer; the elements themselves are stored exactly as they are in memory.
+//
+//   header (64 bytes)  "LLISTBIN", u32 version (2), u32 byte-order mark (0x01020304 in the
+//                      writer's native order), u64 length, u64 element_size, u64 block_count,
+//                      u64 index_offset, u32 block_elements, u32 flags, u32 reserved,
+//                      u32 CRC32C of the first 60 bytes
+//   blocks             u32 element count, u32 CRC32C of the elements, 8 zero bytes, then the
+//                      elements (so elements sit as aligned in the file as in memory, see
+//                      load_from_file_mmap)
+//   index              per block: u64 file offset, u32 element count, u32 CRC32C;
+//                      then u32 CRC32C of the index entries (the file ends here)
+//
+// Files without the magic are legacy files ([size_t length][size_t element_size][raw bytes...]).
+#define BINARY_MAGIC "LLISTBIN"
+#define BINARY_VERSION 2
+#define BINARY_BYTE_ORDER_MARK 0x01020304u
+#define BINARY_HEADER_BYTES 64
+#define BINARY_BLOCK_HEADER_BYTES 16
+#define BINARY_INDEX_ENTRY_BYTES 16
+#define BINARY_BLOCK_BYTES (1u << 20)  // Target element bytes per block
+#define BINARY_LOAD_THREADS 4          // Blocks read and checked at the same time
+
+static void put_le32(unsigned char* bytes, uint32_t value) {
+    for (int i = 0; i < 4; i++) bytes[i] = (unsigned char)(value >> (8 * i));
+}
 
-    void* max_elem = list->head->next->data;
-    Node* current = list->head->next->next;
+static void put_le64(unsigned char* bytes, uint64_t value) {
+    for (int i = 0; i < 8; i++) bytes[i] = (unsigned char)(value >> (8 * i));
+}
 
-    while (current != list->tail) {
-        if (compare(current->data, max_elem) > 0) {
-            max_elem = current->data;
+static uint32_t get_le32(const unsigned char* bytes) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; i--) value = (value << 8) | bytes[i];
+    return value;
+}
+
+static uint64_t get_le64(const unsigned char* bytes) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) value = (value << 8) | bytes[i];
+    return value;
+}
+
+// CRC32C (Castagnoli): SSE4.2 crc32 instructions when the CPU has them, otherwise slicing-by-8
+static uint32_t crc32c_table[8][256];
+static uint32_t (*crc32c_update)(uint32_t, const unsigned char*, size_t);
+static pthread_once_t crc32c_once = PTHREAD_ONCE_INIT;
+
+static uint32_t crc32c_portable(uint32_t crc, const unsigned char* data, size_t n) {
+
+    while (n >= 8) {
+        uint32_t low = crc ^ get_le32(data);
+        uint32_t high = get_le32(data + 4);
+        crc = crc32c_table[7][low & 0xFF] ^ crc32c_table[6][(low >> 8) & 0xFF] ^
+              crc32c_table[5][(low >> 16) & 0xFF] ^ crc32c_table[4][low >> 24] ^
+              crc32c_table[3][high & 0xFF] ^ crc32c_table[2][(high >> 8) & 0xFF] ^
+              crc32c_table[1][(high >> 16) & 0xFF] ^ crc32c_table[0][high >> 24];
+        data += 8;
+        n -= 8;
+    }
+    while (n--) {
+        crc = crc32c_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#ifdef LIST_SIMD_X86
+static __attribute__((target("sse4.2"))) uint32_t crc32c_sse42(uint32_t crc, const unsigned char* data, size_t n) {
+#ifdef __x86_64__
+    uint64_t wide = crc;
+    for (; n >= 8; data += 8, n -= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = (uint32_t)wide;
+#endif
+    for (; n >= 4; data += 4, n -= 4) {
+        uint32_t word;
+        memcpy(&word, data, 4);
+        crc = _mm_crc32_u32(crc, word);
+    }
+    while (n--) {
+        crc = _mm_crc32_u8(crc, *data++);
+    }
+    return crc;
+}
+#endif
+
+static void crc32c_init(void) {
+
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1)));
+        crc32c_table[0][i] = crc;
+    }
+    for (int k = 1; k < 8; k++) {
+        for (int i = 0; i < 256; i++) {
+            uint32_t previous = crc32c_table[k - 1][i];
+            crc32c_table[k][i] = (previous >> 8) ^ crc32c_table[0][previous & 0xFF];
         }
-        current = current->next;
     }
-    return max_elem;
+
+    crc32c_update = crc32c_portable;
+#ifdef LIST_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) crc32c_update = crc32c_sse42;
+#endif
 }
 
-/**
- * @brief Creates a new list with unique elements based on the default compare function, preserving the first occurrence.
- * @param list The source list.
- * @return A new list with unique elements, or NULL on failure.
- */
-LinkedList* unique(const LinkedList* list, CompareFunction compare_fn) { 
-    return unique_advanced(list, compare_fn, START_FROM_HEAD); 
+// INTERNAL HELPER FUNCTION returning the CRC32C of 'n' bytes (safe to call from several threads)
+static uint32_t crc32c(const void* data, size_t n) {
+    pthread_once(&crc32c_once, crc32c_init);
+    return ~crc32c_update(~0u, data, n);
 }
 
-/**
- * @brief Creates a new list with unique elements based on a custom comparison function and preservation order.
- * @param list The source list.
- * @param custom_compare A function to determine uniqueness. If NULL, the list's default compare function is used.
- * @param order START_FROM_HEAD to keep the first seen unique element, START_FROM_TAIL to keep the last.
- * @return A new list with unique elements, or NULL on failure.
- */
-LinkedList* unique_advanced(const LinkedList* list, CompareFunction compare_fn, Direction order) {
-    if (!list) return NULL;
-    if (!compare_fn) return NULL;
+// INTERNAL HELPER FUNCTION for save_to_file(FILE_FORMAT_BINARY): writes the v2 layout above
+static ListResult save_binary(const LinkedList* list, FILE* file) {
+
+    size_t size = list->element_size;
+    size_t block_elements = BINARY_BLOCK_BYTES / size ? BINARY_BLOCK_BYTES / size : 1;
+    uint64_t block_count = (list->length + block_elements - 1) / block_elements;
+    uint64_t index_offset = BINARY_HEADER_BYTES + block_count * BINARY_BLOCK_HEADER_BYTES +
+                            (uint64_t)list->length * size;
+
+    unsigned char header[BINARY_HEADER_BYTES] = { 0 };
+    uint32_t mark = BINARY_BYTE_ORDER_MARK;
+    memcpy(header, BINARY_MAGIC, 8);
+    put_le32(header + 8, BINARY_VERSION);
+    memcpy(header + 12, &mark, 4);
+    put_le64(header + 16, list->length);
+    put_le64(header + 24, size);
+    put_le64(header + 32, block_count);
+    put_le64(header + 40, index_offset);
+    put_le32(header + 48, (uint32_t)block_elements);
+    put_le32(header + 60, crc32c(header, 60));
+
+    // Contiguous storage writes straight from the list; the others gather each block first
+    bool contiguous = (list->storage == LIST_STORAGE_CONTIGUOUS);
+    size_t index_bytes = block_count * BINARY_INDEX_ENTRY_BYTES;
+    unsigned char* index = malloc(index_bytes + 4);
+    unsigned char* buffer = contiguous ? NULL : malloc(block_elements * size);
+    if (!index || (!contiguous && !buffer)) {
+        free(index);
+        free(buffer);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
 
-    LinkedList* unique_list = create_list(list->element_size);
-    if (!unique_list) return NULL;
+    bool ok = fwrite(header, sizeof(header), 1, file) == 1;
 
-    copy_list_configuration(unique_list, list);
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    const unsigned char* run = NULL;
+    size_t run_left = 0;
+    uint64_t offset = BINARY_HEADER_BYTES;
 
-    if (order == START_FROM_TAIL) {
-        // To preserve the last occurrence, we iterate the source list in reverse.
-        Node* current = list->tail->prev;
-        while (current != list->head) {
-            // Check if the element is already in our unique list.
-            bool found = false;
-            Node* unique_current = unique_list->head->next;
-            while (unique_current != unique_list->tail) {
-                if (compare_fn(current->data, unique_current->data) == 0) {
-                    found = true;
-                    break;
-                }
-                unique_current = unique_current->next;
-            }
+    for (uint64_t b = 0; ok && b < block_count; b++) {
+        size_t first = b * block_elements;
+        size_t count = list->length - first < block_elements ? list->length - first : block_elements;
+        const unsigned char* payload = buffer;
 
-            if (!found) {
-                // Since we are iterating backwards, we insert at the head to maintain the original relative order.
-                if (insert_head_value_internal(unique_list, current->data) != LIST_SUCCESS) {
-                    destroy(unique_list);
-                    return NULL;
-                }
+        if (contiguous) {
+            payload = contiguous_at(list, first);
+        } else {
+            for (size_t filled = 0; filled < count; ) {
+                if (run_left == 0) run = walk_next_run(&walk, &run_left);
+                size_t take = run_left < count - filled ? run_left : count - filled;
+                memcpy(buffer + filled * size, run, take * size);
+                run += take * size;
+                run_left -= take;
+                filled += take;
             }
-            current = current->prev;
         }
-    } else { // START_FROM_HEAD
-        // To preserve the first occurrence, we iterate the source list forwards.
-        Node* current = list->head->next;
-        while (current != list->tail) {
-            // Check if the element is already in our unique list.
-            bool found = false;
-            Node* unique_current = unique_list->head->next;
-            while (unique_current != unique_list->tail) {
-                if (compare_fn(current->data, unique_current->data) == 0) {
-                    found = true;
-                    break;
-                }
-                unique_current = unique_current->next;
+
+        uint32_t crc = crc32c(payload, count * size);
+        unsigned char block_header[BINARY_BLOCK_HEADER_BYTES] = { 0 };
+        put_le32(block_header, (uint32_t)count);
+        put_le32(block_header + 4, crc);
+
+        unsigned char* entry = index + b * BINARY_INDEX_ENTRY_BYTES;
+        put_le64(entry, offset);
+        put_le32(entry + 8, (uint32_t)count);
+        put_le32(entry + 12, crc);
+
+        ok = fwrite(block_header, sizeof(block_header), 1, file) == 1 &&
+             fwrite(payload, size, count, file) == count;
+        offset += BINARY_BLOCK_HEADER_BYTES + (uint64_t)count * size;
+    }
+
+    put_le32(index + index_bytes, crc32c(index, index_bytes));
+    ok = ok && fwrite(index, index_bytes + 4, 1, file) == 1;
+
+    free(index);
+    free(buffer);
+    return ok ? LIST_SUCCESS : LIST_ERROR_IO;
+}
+
+// One block of a v2 file, as listed in its index
+typedef struct {
+    uint64_t offset;  // File position of the block header
+    size_t first;     // List index of the block's first element
+    uint32_t count;
+    uint32_t crc;
+} BinaryBlock;
+
+// What binary_open() learned about a binary file
+typedef struct {
+    bool legacy;
+    size_t length;
+    size_t element_size;
+    size_t block_count;    // v2 only
+    size_t largest_block;  // v2 only: most elements in one block
+    BinaryBlock* blocks;   // v2 only, freed by the caller
+} BinaryFileInfo;
+
+// INTERNAL HELPER FUNCTION reading and checking the header (and v2 index) of a binary list file
+static ListResult binary_open(FILE* file, BinaryFileInfo* info) {
+
+    memset(info, 0, sizeof(*info));
+    if (fseek(file, 0, SEEK_END) != 0) return LIST_ERROR_IO;
+    long end = ftell(file);
+    if (end < 0 || fseek(file, 0, SEEK_SET) != 0) return LIST_ERROR_IO;
+    uint64_t file_size = (uint64_t)end;
+
+    unsigned char header[BINARY_HEADER_BYTES];
+    if (fread(header, 1, 8, file) != 8) return LIST_ERROR_CORRUPT_DATA;
+
+    if (memcmp(header, BINARY_MAGIC, 8) != 0) {
+        // Legacy layout: native size_t length and element size, then the elements
+        size_t saved[2];
+        if (fseek(file, 0, SEEK_SET) != 0) return LIST_ERROR_IO;
+        if (fread(saved, sizeof(size_t), 2, file) != 2) return LIST_ERROR_CORRUPT_DATA;
+        if (saved[1] == 0 || saved[0] > (file_size - sizeof(saved)) / saved[1]) return LIST_ERROR_CORRUPT_DATA;
+        info->legacy = true;
+        info->length = saved[0];
+        info->element_size = saved[1];
+        return LIST_SUCCESS;
+    }
+
+    uint32_t mark;
+    if (fread(header + 8, 1, BINARY_HEADER_BYTES - 8, file) != BINARY_HEADER_BYTES - 8 ||
+        get_le32(header + 60) != crc32c(header, 60)) return LIST_ERROR_CORRUPT_DATA;
+    memcpy(&mark, header + 12, 4);
+    if (get_le32(header + 8) != BINARY_VERSION || mark != BINARY_BYTE_ORDER_MARK) return LIST_ERROR_CORRUPT_DATA;
+
+    uint64_t length = get_le64(header + 16);
+    uint64_t element_size = get_le64(header + 24);
+    uint64_t block_count = get_le64(header + 32);
+    uint64_t index_offset = get_le64(header + 40);
+
+    // The index runs from index_offset to the end of the file
+    if (element_size == 0 || length > file_size ||
+        block_count > file_size / BINARY_INDEX_ENTRY_BYTES ||
+        index_offset < BINARY_HEADER_BYTES || index_offset > file_size ||
+        index_offset + block_count * BINARY_INDEX_ENTRY_BYTES + 4 != file_size) return LIST_ERROR_CORRUPT_DATA;
+
+    size_t index_bytes = block_count * BINARY_INDEX_ENTRY_BYTES;
+    unsigned char* index = malloc(index_bytes + 4);
+    BinaryBlock* blocks = malloc((block_count ? block_count : 1) * sizeof(BinaryBlock));
+    if (!index || !blocks) {
+        free(index);
+        free(blocks);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+
+    ListResult result = LIST_SUCCESS;
+    if (fseek(file, (long)index_offset, SEEK_SET) != 0 || fread(index, 1, index_bytes + 4, file) != index_bytes + 4) {
+        result = LIST_ERROR_IO;
+    } else if (get_le32(index + index_bytes) != crc32c(index, index_bytes)) {
+        result = LIST_ERROR_CORRUPT_DATA;
+    }
+
+    uint64_t total = 0;
+    for (size_t b = 0; result == LIST_SUCCESS && b < block_count; b++) {
+        const unsigned char* entry = index + b * BINARY_INDEX_ENTRY_BYTES;
+        blocks[b] = (BinaryBlock){ get_le64(entry), (size_t)total, get_le32(entry + 8), get_le32(entry + 12) };
+        // Every block must lie between the header and the index
+        if (blocks[b].count == 0 || blocks[b].offset < BINARY_HEADER_BYTES ||
+            blocks[b].offset + BINARY_BLOCK_HEADER_BYTES > index_offset ||
+            blocks[b].count > (index_offset - blocks[b].offset - BINARY_BLOCK_HEADER_BYTES) / element_size) {
+            result = LIST_ERROR_CORRUPT_DATA;
+        }
+        if (blocks[b].count > info->largest_block) info->largest_block = blocks[b].count;
+        total += blocks[b].count;
+    }
+    if (result == LIST_SUCCESS && total != length) result = LIST_ERROR_CORRUPT_DATA;
+
+    free(index);
+    if (result != LIST_SUCCESS) {
+        free(blocks);
+        return result;
+    }
+    info->length = (size_t)length;
+    info->element_size = (size_t)element_size;
+    info->block_count = (size_t)block_count;
+    info->blocks = blocks;
+    return LIST_SUCCESS;
+}
+
+// One block read: every task has its own stream, so tasks can seek and read at the same time
+typedef struct {
+    FILE* file;
+    const BinaryBlock* block;
+    size_t element_size;
+    unsigned char* buffer;  // Receives the block's elements
+    ListResult result;
+} BlockReadTask;
+
+static void* read_block_task(void* arg) {
+
+    BlockReadTask* task = arg;
+    const BinaryBlock* block = task->block;
+    size_t bytes = (size_t)block->count * task->element_size;
+    unsigned char block_header[BINARY_BLOCK_HEADER_BYTES];
+
+    if (fseek(task->file, (long)block->offset, SEEK_SET) != 0 ||
+        fread(block_header, sizeof(block_header), 1, task->file) != 1 ||
+        fread(task->buffer, 1, bytes, task->file) != bytes) {
+        task->result = LIST_ERROR_IO;
+    } else if (get_le32(block_header) != block->count || get_le32(block_header + 4) != block->crc ||
+               get_le64(block_header + 8) != 0 || crc32c(task->buffer, bytes) != block->crc) {
+        task->result = LIST_ERROR_CORRUPT_DATA;
+    } else {
+        task->result = LIST_SUCCESS;
+    }
+    return NULL;
+}
+
+// INTERNAL HELPER FUNCTION running read_block_task() for every task, one thread each
+// (same scheme as run_sort_tasks: the caller takes the first task, failed threads run inline)
+static void run_block_reads(BlockReadTask* tasks, size_t count) {
+
+    pthread_t threads[BINARY_LOAD_THREADS];
+    bool started[BINARY_LOAD_THREADS] = { false };
+
+    for (size_t i = 1; i < count; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, read_block_task, &tasks[i]) == 0);
+    }
+    read_block_task(&tasks[0]);
+    for (size_t i = 1; i < count; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+        else read_block_task(&tasks[i]);
+    }
+}
+
+// INTERNAL HELPER FUNCTION appending elements [start, end) of an opened binary file to 'list'.
+// With list == NULL the elements are only checked. v2 files skip every block outside the range
+// and read up to BINARY_LOAD_THREADS blocks at once, each on its own stream of 'filename'.
+static ListResult binary_read(FILE* file, const char* filename, const BinaryFileInfo* info,
+                              size_t start, size_t end, LinkedList* list) {
+
+    size_t size = info->element_size;
+
+    if (info->legacy) {
+        if (!list || start == end) return LIST_SUCCESS;
+        size_t chunk = BINARY_BLOCK_BYTES / size ? BINARY_BLOCK_BYTES / size : 1;
+        unsigned char* buffer = malloc(chunk * size);
+        if (!buffer) return LIST_ERROR_MEMORY_ALLOC;
+        ListResult result = fseek(file, (long)(2 * sizeof(size_t) + start * size), SEEK_SET) == 0
+                            ? LIST_SUCCESS : LIST_ERROR_IO;
+        for (size_t done = start; result == LIST_SUCCESS && done < end; done += chunk) {
+            size_t count = end - done < chunk ? end - done : chunk;
+            if (fread(buffer, size, count, file) != count) result = LIST_ERROR_IO;
+            for (size_t i = 0; result == LIST_SUCCESS && i < count; i++) {
+                result = insert_tail_value_internal(list, buffer + i * size);
             }
+        }
+        free(buffer);
+        return result;
+    }
 
-            if (!found) {
-                if (insert_tail_value_internal(unique_list, current->data) != LIST_SUCCESS) {
-                    destroy(unique_list);
-                    return NULL;
-                }
+    // First block holding element 'start' (blocks are in list order)
+    size_t low = 0;
+    size_t high = info->block_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (info->blocks[mid].first + info->blocks[mid].count <= start) low = mid + 1;
+        else high = mid;
+    }
+    size_t first_block = low;
+    size_t last_block = first_block;
+    while (last_block < info->block_count && info->blocks[last_block].first < end) last_block++;
+    if (first_block == last_block) return LIST_SUCCESS;
+
+    // One stream and one buffer per task; a stream that fails to open just means fewer tasks
+    BlockReadTask tasks[BINARY_LOAD_THREADS];
+    size_t task_count = 0;
+    size_t wanted = last_block - first_block < BINARY_LOAD_THREADS ? last_block - first_block : BINARY_LOAD_THREADS;
+    ListResult result = LIST_SUCCESS;
+    while (task_count < wanted) {
+        FILE* stream = task_count == 0 ? file : fopen(filename, "rb");
+        unsigned char* buffer = stream ? malloc(info->largest_block * size) : NULL;
+        if (!buffer) {
+            if (stream && stream != file) fclose(stream);
+            if (task_count == 0) result = LIST_ERROR_MEMORY_ALLOC;
+            break;
+        }
+        tasks[task_count++] = (BlockReadTask){ .file = stream, .element_size = size, .buffer = buffer };
+    }
+
+    for (size_t b = first_block; result == LIST_SUCCESS && b < last_block; b += task_count) {
+        size_t round = last_block - b < task_count ? last_block - b : task_count;
+        for (size_t t = 0; t < round; t++) tasks[t].block = &info->blocks[b + t];
+        run_block_reads(tasks, round);
+
+        for (size_t t = 0; result == LIST_SUCCESS && t < round; t++) {
+            const BinaryBlock* block = tasks[t].block;
+            result = tasks[t].result;
+            if (!list) continue;
+            size_t from = start > block->first ? start - block->first : 0;
+            size_t to = end - block->first < block->count ? end - block->first : block->count;
+            for (size_t i = from; result == LIST_SUCCESS && i < to; i++) {
+                result = insert_tail_value_internal(list, tasks[t].buffer + i * size);
             }
-            current = current->next;
         }
     }
 
-    return unique_list;
+    for (size_t t = 0; t < task_count; t++) {
+        if (tasks[t].file != file) fclose(tasks[t].file);
+        free(tasks[t].buffer);
+    }
+    return result;
+}
+
+// Outcome of the last load on each thread (see load_from_file_error())
+static _Thread_local ListLoadError load_error;
+
+// INTERNAL HELPER FUNCTION recording why a load stopped (line 0 = not tied to a text position)
+static void note_load_error(ListResult result, size_t line, size_t column, const char* message) {
+    load_error.result = result;
+    load_error.line = line;
+    load_error.column = column;
+    load_error.message = message;
 }
 
 /**
- * @brief Helper function to find index of element using compare function.
- * @param list The list to search in.
- * @param data The data to search for.
- * @param compare_fn Comparison function.
- * @return Index if found, -1 if not found.
+ * @brief Reports how the calling thread's last load went.
+ * @return Result of the last load_from_file(), load_range_from_file() or load_from_file_mmap()
+ *         call on this thread, with the 1-based line and byte column of the offending token
+ *         when malformed text stopped it.
+ * @note Each load resets the report, so read it right after the load returned NULL.
  */
-static int index_of_with_compare(const LinkedList* list, const void* data, CompareFunction compare_fn) {
-    if (!list || !data || !compare_fn) return -1;
-    
-    Node* current = list->head->next;
-    int index = 0;
-    while (current != list->tail) {
-        if (compare_fn(current->data, data) == 0) {
-            return index;
+ListLoadError load_from_file_error(void) {
+    return load_error;
+}
+
+// INTERNAL HELPER FUNCTION for the binary loaders: a new list with elements [start, start + count)
+// of 'filename' (count is clipped at the end of the file), or NULL
+static LinkedList* load_binary(const char* filename, size_t element_size, size_t start, size_t count) {
+
+    note_load_error(LIST_SUCCESS, 0, 0, NULL);
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        note_load_error(LIST_ERROR_IO, 0, 0, "cannot open file");
+        return NULL;
+    }
+
+    BinaryFileInfo info;
+    LinkedList* list = NULL;
+    ListResult result = binary_open(file, &info);
+    if (result == LIST_SUCCESS) {
+        if (info.element_size != element_size) {
+            note_load_error(LIST_ERROR_INVALID_OPERATION, 0, 0, "element size does not match the file");
+        } else if (start > info.length) {
+            note_load_error(LIST_ERROR_INDEX_OUT_OF_BOUNDS, 0, 0, "start is past the end of the file");
+        } else {
+            size_t end = info.length - start < count ? info.length : start + count;
+            list = create_list(element_size);
+            result = list ? binary_read(file, filename, &info, start, end, list) : LIST_ERROR_MEMORY_ALLOC;
+            if (result != LIST_SUCCESS) {
+                note_load_error(result, 0, 0, NULL);
+                destroy(list);
+                list = NULL;
+            }
         }
-        current = current->next;
-        index++;
+        free(info.blocks);
+    } else {
+        note_load_error(result, 0, 0, NULL);
     }
-    return -1;
+    fclose(file);
+    return list;
 }
 
 /**
- * @brief Creates a new list containing the intersection of two lists.
- * @param list1 First list.
- * @param list2 Second list.
- * @return A new list with common elements, or NULL on failure.
+ * @brief Checks a binary list file without loading it.
+ * @param filename File written by save_to_file() with FILE_FORMAT_BINARY.
+ * @return LIST_SUCCESS if the file is intact, LIST_ERROR_CORRUPT_DATA if a header, index or block
+ *         checksum does not match (or the file is not a list file), LIST_ERROR_IO on read errors.
+ * @note Legacy (pre-v2) files have no checksums; only their size is checked.
  */
-LinkedList* intersection(const LinkedList* list1, const LinkedList* list2, CompareFunction compare_fn) {
-    if (!list1 || !list2 || !compare_fn) return NULL;
-    if (list1->element_size != list2->element_size) return NULL;
-    
-    LinkedList* intersection = create_list(list1->element_size);
-    if (!intersection) return NULL;
-    
-    // Configure the intersection list with settings from first list
-    copy_list_configuration(intersection, list1);
-    
-    Node* current = list1->head->next;
-    while (current != list1->tail) {
+ListResult verify_list_file(const char* filename) {
 
-        // If element exists in both lists and not already in result
-        if (index_of_with_compare(list2, current->data, compare_fn) != -1 && 
-            index_of_with_compare(intersection, current->data, compare_fn) == -1) {
-            if (insert_tail_value_internal(intersection, current->data) != LIST_SUCCESS) {
-                destroy(intersection);
-                return NULL;
-            }
-        }
-        current = current->next;
+    if (!filename) return LIST_ERROR_NULL_POINTER;
+    FILE* file = fopen(filename, "rb");
+    if (!file) return LIST_ERROR_IO;
+
+    BinaryFileInfo info;
+    ListResult result = binary_open(file, &info);
+    if (result == LIST_SUCCESS) {
+        result = binary_read(file, filename, &info, 0, info.length, NULL);
+        free(info.blocks);
     }
-    
-    return intersection;
+    fclose(file);
+    return result;
 }
 
 /**
- * @brief Creates a new list containing the union of two lists.
- * @param list1 First list.
- * @param list2 Second list.
- * @return A new list with all unique elements from both lists, or NULL on failure.
+ * @brief Loads part of a binary list file.
+ * @param filename File written by save_to_file() with FILE_FORMAT_BINARY.
+ * @param element_size Size of each element (must match the file).
+ * @param start Index of the first element to load.
+ * @param count Number of elements to load (fewer if the file ends first).
+ * @return New list on success, NULL on failure (or if start is past the last element).
+ * @note v2 files only read the blocks that hold the range; their checksums are still verified.
  */
-LinkedList* union_lists(const LinkedList* list1, const LinkedList* list2, CompareFunction compare_fn) {
-    if (!list1 || !list2 || !compare_fn) return NULL;
-    if (list1->element_size != list2->element_size) return NULL;
-    
-    // Start with unique elements from first list
-    LinkedList* union_list = unique(list1, compare_fn);
-    if (!union_list) return NULL;
-    
-    // Add unique elements from second list
-    Node* current = list2->head->next;
-    while (current != list2->tail) {
-    if (index_of_with_compare(union_list, current->data, compare_fn) == -1) {
-            if (insert_tail_value_internal(union_list, current->data) != LIST_SUCCESS) {
-                destroy(union_list);
-                return NULL;
-            }
-        }
-        current = current->next;
+LinkedList* load_range_from_file(const char* filename, size_t element_size, size_t start, size_t count) {
+    if (!filename || count == 0) return NULL;
+    LinkedList* list = load_binary(filename, element_size, start, count);
+    if (list && list->length == 0) {
+        destroy(list);
+        return NULL;
     }
-    
-    return union_list;
+    return list;
+}
+
+
+// A file mapped by load_from_file_mmap(): the borrowed elements live in 'address', their nodes in 'nodes'
+struct FileMapping {
+    void* address;
+    size_t size;
+    Node* nodes;
+};
+
+// INTERNAL HELPER FUNCTION unmapping the file of a load_from_file_mmap() list (no-op for other lists).
+// Only call it once no borrowed node is left in the list.
+static void release_file_mapping(LinkedList* list) {
+
+    struct FileMapping* mapping = list->mapping;
+    if (!mapping) return;
+
+#ifdef LIST_HAVE_MMAP
+    munmap(mapping->address, mapping->size);
+#endif
+    free(mapping->nodes);
+    free(mapping);
+    list->mapping = NULL;
+}
+
+#ifdef LIST_HAVE_MMAP
+// INTERNAL HELPER FUNCTION telling whether element bytes at 'address' are aligned well enough to be
+// used in place (the largest power of two dividing the element size, at most max_align_t's)
+static bool mapped_elements_aligned(const unsigned char* address, size_t element_size) {
+    size_t alignment = element_size & (~element_size + 1);
+    if (alignment > _Alignof(max_align_t)) alignment = _Alignof(max_align_t);
+    return (uintptr_t)address % alignment == 0;
 }
 
-/*
-┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
-┃                                               ┃
-┃              10. List <--> Array              ┃
-┃                                               ┃
-┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
- */
+// INTERNAL HELPER FUNCTION mapping a binary file and linking one borrowed node per element.
+// Returns NULL when the file cannot be used in place (the caller then reads it instead).
+static LinkedList* map_binary_file(const char* filename, size_t element_size, bool* unusable) {
+
+    *unusable = true;
+    FILE* file = fopen(filename, "rb");
+    if (!file) return NULL;
+    BinaryFileInfo info;
+    ListResult opened = binary_open(file, &info);
+    fclose(file);
+    if (opened != LIST_SUCCESS || info.element_size != element_size) {
+        if (opened == LIST_SUCCESS) free(info.blocks);
+        note_load_error(opened != LIST_SUCCESS ? opened : LIST_ERROR_INVALID_OPERATION, 0, 0,
+                        opened != LIST_SUCCESS ? NULL : "element size does not match the file");
+        *unusable = false; // Reading would fail just the same
+        return NULL;
+    }
+
+    LinkedList* list = create_list(element_size);
+    struct FileMapping* mapping = calloc(1, sizeof(struct FileMapping));
+    int fd = open(filename, O_RDONLY);
+    struct stat status;
+    bool ok = list && mapping && fd >= 0 && fstat(fd, &status) == 0 && status.st_size > 0;
+
+    if (ok && info.length > 0) {
+        // A private writable mapping: set_node_value() and friends change the list, never the file
+        mapping->size = (size_t)status.st_size;
+        mapping->address = mmap(NULL, mapping->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (mapping->address == MAP_FAILED) mapping->address = NULL;
+        mapping->nodes = malloc(info.length * sizeof(Node));
+        ok = mapping->address && mapping->nodes;
+    }
+    if (fd >= 0) close(fd);
+
+    // Link the nodes block by block (a legacy file is one block right after its header)
+    Node* previous = list ? list->head : NULL;
+    size_t block_count = info.legacy ? 1 : info.block_count;
+    size_t k = 0;
+    for (size_t b = 0; ok && info.length > 0 && b < block_count; b++) {
+        const unsigned char* elements = (const unsigned char*)mapping->address +
+            (info.legacy ? 2 * sizeof(size_t) : info.blocks[b].offset + BINARY_BLOCK_HEADER_BYTES);
+        size_t count = info.legacy ? info.length : info.blocks[b].count;
+        if (!mapped_elements_aligned(elements, element_size)) {
+            ok = false;
+            break;
+        }
+        for (size_t i = 0; i < count; i++, k++) {
+            Node* node = &mapping->nodes[k];
+            node->data = (void*)(elements + i * element_size);
+            node->mode = LIST_MODE_BORROWED;
+            node->prev = previous;
+            previous->next = node;
+            previous = node;
+        }
+    }
+    free(info.blocks);
+
+    if (!ok) {
+        if (list) {
+            list->head->next = list->tail; // Drop the half-linked borrowed nodes
+            destroy(list);
+        }
+        if (mapping) {
+            if (mapping->address) munmap(mapping->address, mapping->size);
+            free(mapping->nodes);
+            free(mapping);
+        }
+        return NULL;
+    }
 
-/**
- * @brief Converts an array to a linked list.
- * @param list The list to populate with array elements.
- * @param arr Pointer to the array data.
- * @param n Number of elements in the array.
- * @return LIST_SUCCESS on success, error code on failure.
- */
-ListResult from_array(LinkedList* list, const void* arr, size_t n) {
-    if (!list || !arr) return LIST_ERROR_NULL_POINTER;
-    
-    // Clear the list first
-    ListResult clear_result = clear(list);
-    if (clear_result != LIST_SUCCESS) return clear_result;
-    
-    // Add each element from the array
-    const char* byte_arr = (const char*)arr;
-    for (size_t i = 0; i < n; i++) {
-        const void* element = byte_arr + (i * list->element_size);
-    ListResult result = insert_tail_value_internal(list, (void*)element);
-        if (result != LIST_SUCCESS) return result;
+    previous->next = list->tail;
+    list->tail->prev = previous;
+    list->length = info.length;
+    if (info.length > 0) {
+        list->mapping = mapping;
+    } else {
+        free(mapping);
     }
-    
-    return LIST_SUCCESS;
+    *unusable = false;
+    return list;
 }
+#endif
 
 /**
- * @brief Converts a linked list to an array.
- * @param list The list to convert.
- * @param out_size Pointer to store the number of elements in the array.
- * @return Pointer to the newly allocated array, or NULL on failure.
- * @note The caller is responsible for freeing the returned array.
+ * @brief Opens a binary list file by mapping it into memory instead of reading it.
+ * @param filename File written by save_to_file() with FILE_FORMAT_BINARY (v2 or legacy).
+ * @param element_size Size of each element (must match the file).
+ * @return New list on success, NULL on failure.
+ * @note Nodes point straight into the mapping (LIST_MODE_BORROWED), so no element is copied and
+ *       pages are only read from disk when touched. destroy() (or clear()) unmaps the file.
+ *       The mapping is private: changing elements never changes the file. Block checksums are
+ *       not verified; call verify_list_file() first for that. Where mapping is not available
+ *       (or the elements would be misaligned in the mapping) the file is read normally.
  */
-void* to_array(const LinkedList* list, size_t* out_size) {
-    if (!list || !out_size) return NULL;
-    
-    *out_size = list->length;
-    if (list->length == 0) return NULL;
-    
-    // Allocate memory for the array
-    void* array = malloc(list->length * list->element_size);
-    if (!array) return NULL;
-    
-    // Copy elements from list to array
-    char* byte_array = (char*)array;
-    Node* current = list->head->next;
-    size_t index = 0;
-    
-    while (current != list->tail) {
-        void* dest = byte_array + (index * list->element_size);
-        memcpy(dest, current->data, list->element_size);
-        current = current->next;
-        index++;
+LinkedList* load_from_file_mmap(const char* filename, size_t element_size) {
+
+    if (!filename) return NULL;
+
+#ifdef LIST_HAVE_MMAP
+    note_load_error(LIST_SUCCESS, 0, 0, NULL);
+    bool unusable;
+    LinkedList* list = map_binary_file(filename, element_size, &unusable);
+    if (list || !unusable) return list;
+#endif
+
+    return load_binary(filename, element_size, 0, SIZE_MAX);
+}
+
+// Buffered text output for save_to_file(): elements are formatted straight into a large buffer
+// that goes to the (unbuffered) stream in one write per TEXT_WRITE_BUFFER_BYTES, instead of one
+// fprintf call per element (or per byte for hex dumps).
+#define TEXT_WRITE_BUFFER_BYTES (1u << 20)
+#define TEXT_WRITE_MAX_TOKEN 64  // Room reserved for one formatted number
+
+typedef struct {
+    FILE* file;
+    char* data;
+    size_t used;
+    size_t capacity;
+    bool failed;  // A write to 'file' came up short
+} WriteBuffer;
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// INTERNAL HELPER FUNCTION writing out everything buffered so far
+static void write_buffer_flush(WriteBuffer* out) {
+    if (out->used && fwrite(out->data, 1, out->used, out->file) != out->used) out->failed = true;
+    out->used = 0;
+}
+
+// INTERNAL HELPER FUNCTION making room for 'bytes' more characters (bytes <= capacity)
+static inline char* write_buffer_reserve(WriteBuffer* out, size_t bytes) {
+    if (out->capacity - out->used < bytes) write_buffer_flush(out);
+    return out->data + out->used;
+}
+
+static void write_buffer_put(WriteBuffer* out, const char* text, size_t length) {
+    while (length > 0) {
+        if (out->used == out->capacity) write_buffer_flush(out);
+        size_t chunk = out->capacity - out->used < length ? out->capacity - out->used : length;
+        memcpy(out->data + out->used, text, chunk);
+        out->used += chunk;
+        text += chunk;
+        length -= chunk;
     }
-    
-    return array;
 }
 
+static inline void write_buffer_put_char(WriteBuffer* out, char c) {
+    *write_buffer_reserve(out, 1) = c;
+    out->used++;
+}
 
+// INTERNAL HELPER FUNCTION formatting 'value' like printf("%d"), two digits at a time
+static void write_buffer_put_int(WriteBuffer* out, int value) {
 
-/*
-┏━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┓
-┃                                               ┃
-┃          11. List <--> String (file)          ┃
-┃                                               ┃
-┗━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━┛
- */
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
 
-/**
- * Converts the list into a single C string (null-terminated).
- * Simple, human-readable representation intended for logging / quick export.
- * IMPORTANT LIMITATIONS:
- *   1. Only primitive element sizes (int / double / char) are rendered with real values.
- *      Any other element size becomes the literal token "[data]" (no round‑trip guaranteed).
- *   2. This is NOT meant for lossless serialization. Use save_to_file() with FILE_FORMAT_* for that.
- *   3. We allocate an estimated buffer (length * 50 chars per element) which is usually
- *      enough for typical numeric sizes. If you store very large textual numbers you may
- *      want to re‑implement with dynamic growth (realloc).
- * Memory ownership: caller must free the returned pointer.
- */
-char* to_string(const LinkedList* list, const char* separator) {
-    
-    if (!list || !separator) return NULL;
-    if (!list->print_node_function) return NULL;
+    char digits[12];
+    char* end = digits + sizeof(digits);
+    char* start = end;
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
 
-    // Edge case: empty list
-    if (is_empty(list)) {
-        char* empty = malloc(1);
-        if (empty) empty[0] = '\0';
-        return empty;
+    while (magnitude >= 100) {
+        unsigned int pair = magnitude % 100;
+        magnitude /= 100;
+        start -= 2;
+        memcpy(start, pairs + 2 * pair, 2);
     }
-    
-    // Calculate approximate size needed
-    size_t sep_len = strlen(separator);
-    size_t estimated_size = list->length * 50 + (list->length - 1) * sep_len + 1;
-    char* result = malloc(estimated_size);
-    if (!result) return NULL;
-    
-    result[0] = '\0';
-    bool first = true;
-    
-    Node* current = list->head->next;
-    while (current != list->tail) {
-        if (!first) {
-            strcat(result, separator);
-        }
-        
-        // For basic types, we can convert directly
-        if (list->element_size == sizeof(int)) {
-            char temp[32];
-            snprintf(temp, sizeof(temp), "%d", *(int*)current->data);
-            strcat(result, temp);
-        } else if (list->element_size == sizeof(double)) {
-            char temp[64];
-            snprintf(temp, sizeof(temp), "%.2f", *(double*)current->data);
-            strcat(result, temp);
-        } else if (list->element_size == sizeof(char)) {
-            char temp[4];
-            snprintf(temp, sizeof(temp), "%c", *(char*)current->data);
-            strcat(result, temp);
-        } else {
-            // For other types, show generic representation
-            strcat(result, "[data]");
+    if (magnitude >= 10) {
+        start -= 2;
+        memcpy(start, pairs + 2 * magnitude, 2);
+    } else {
+        *--start = (char)('0' + magnitude);
+    }
+    if (value < 0) *--start = '-';
+
+    size_t length = (size_t)(end - start);
+    memcpy(write_buffer_reserve(out, length), start, length);
+    out->used += length;
+}
+
+// INTERNAL HELPER FUNCTION formatting 'value' like printf("%.15g").
+// A double that is the nearest one to a decimal D of at most 15 significant digits prints as D,
+// so values such as 42, 0.25 or -1234.5678 are found as the shortest m / 10^k equal to 'value'
+// (the division is correctly rounded, which makes the check exact) and written by hand. Values
+// that need more digits or an exponent go through snprintf, still without any stdio stream.
+static void write_buffer_put_double(WriteBuffer* out, double value) {
+
+    double magnitude = fabs(value);
+    if (value == 0) {
+        write_buffer_put(out, signbit(value) ? "-0" : "0", signbit(value) ? 2 : 1);
+        return;
+    }
+
+    if (magnitude >= 1e-4 && magnitude < 1e15) {
+        double scale = 1;  // 10^k, exact for every k tried here
+        for (int k = 0; k <= 19; k++, scale *= 10) {
+            double scaled = magnitude * scale;
+            if (scaled >= 1e15) break;
+            double whole = (double)(unsigned long long)(scaled + 0.5);
+            if (whole / scale != magnitude) continue;
+
+            char digits[24];
+            size_t count = 0;
+            for (unsigned long long m = (unsigned long long)whole; m; m /= 10) digits[count++] = (char)('0' + m % 10);
+
+            char* slot = write_buffer_reserve(out, TEXT_WRITE_MAX_TOKEN);
+            char* cursor = slot;
+            if (value < 0) *cursor++ = '-';
+            if (count <= (size_t)k) {
+                *cursor++ = '0';
+                *cursor++ = '.';
+                for (size_t z = count; z < (size_t)k; z++) *cursor++ = '0';
+            }
+            for (size_t i = count; i-- > 0; ) {
+                *cursor++ = digits[i];
+                if (i == (size_t)k && k > 0 && count > (size_t)k) *cursor++ = '.';
+            }
+            out->used += (size_t)(cursor - slot);
+            return;
         }
-        
-        first = false;
-        current = current->next;
     }
-    
-    return result;
+
+    char* slot = write_buffer_reserve(out, TEXT_WRITE_MAX_TOKEN);
+    int length = snprintf(slot, TEXT_WRITE_MAX_TOKEN, "%.*g", 15, value);
+    if (length > 0) out->used += (size_t)length;
+}
+
+// INTERNAL HELPER FUNCTION writing 'size' bytes as space separated hex pairs ("0A FF 12")
+static void write_buffer_put_hex(WriteBuffer* out, const unsigned char* bytes, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        char* slot = write_buffer_reserve(out, 3);
+        slot[0] = hex_digits[bytes[i] >> 4];
+        slot[1] = hex_digits[bytes[i] & 0x0F];
+        slot[2] = ' ';
+        out->used += (i + 1 < size) ? 3 : 2;
+    }
 }
 
 // save_to_file: unified binary/text persistence.
-//   format == FILE_FORMAT_BINARY -> layout: [size_t length][size_t element_size][raw bytes...]
+//   format == FILE_FORMAT_BINARY -> v2 layout (header, checksummed blocks, index; see above)
 //   format == FILE_FORMAT_TEXT   -> primitives printed plainly, others hex (whitespace mode) or skipped (custom separator mode).
 //   separator: for TEXT mode only; placed between tokens (default "\n"). Trailing newline ensured if not present.
 ListResult save_to_file(const LinkedList* list, const char* filename, FileFormat format, const char* separator) {
@@ -1747,12 +7197,9 @@ ListResult save_to_file(const LinkedList* list, const char* filename, FileFormat
     if (format == FILE_FORMAT_BINARY) {
         FILE* file = fopen(filename, "wb");
         if (!file) return LIST_ERROR_INVALID_OPERATION;
-        fwrite(&list->length, sizeof(size_t), 1, file);
-        fwrite(&list->element_size, sizeof(size_t), 1, file);
-        Node* cur = list->head->next;
-        while (cur != list->tail) { fwrite(cur->data, list->element_size, 1, file); cur = cur->next; }
-        fclose(file);
-        return LIST_SUCCESS;
+        ListResult result = save_binary(list, file);
+        if (fclose(file) != 0 && result == LIST_SUCCESS) result = LIST_ERROR_IO;
+        return result;
     }
 
     // TEXT format
@@ -1760,162 +7207,477 @@ ListResult save_to_file(const LinkedList* list, const char* filename, FileFormat
     if (!file) return LIST_ERROR_INVALID_OPERATION;
     if (!separator) separator = "\n"; // default line-per-element
 
-    Node* current = list->head->next;
-    while (current != list->tail) {
+    // The stream gets whole buffers, so its own buffering would only add a copy
+    WriteBuffer out = { file, malloc(TEXT_WRITE_BUFFER_BYTES), 0, TEXT_WRITE_BUFFER_BYTES, false };
+    if (!out.data) {
+        fclose(file);
+        return LIST_ERROR_MEMORY_ALLOC;
+    }
+    setvbuf(file, NULL, _IONBF, 0);
+    size_t sep_len = strlen(separator);
+
+    ElementWalk walk;
+    walk_list(&walk, list, START_FROM_HEAD);
+    size_t written = 0;
+    for (void* element = walk_next(&walk); element; element = walk_next(&walk)) {
         // Support a few primitive element sizes. For other sizes fallback to hex dump length element_size.
         if (list->element_size == sizeof(int)) {
-            fprintf(file, "%d", *(int*)current->data);
+            write_buffer_put_int(&out, *(int*)element);
         } else if (list->element_size == sizeof(double)) {
-            fprintf(file, "%.*g", 15, *(double*)current->data);
+            write_buffer_put_double(&out, *(double*)element);
         } else if (list->element_size == sizeof(char)) {
-            fprintf(file, "%c", *(char*)current->data);
+            write_buffer_put_char(&out, *(char*)element);
         } else {
             // Generic: print as bytes in hex (compact)
-            unsigned char* bytes = (unsigned char*)current->data;
-            for (size_t i = 0; i < list->element_size; ++i) {
-                fprintf(file, "%02X", bytes[i]);
-                if (i + 1 < list->element_size) fputc(' ', file);
-            }
+            write_buffer_put_hex(&out, (const unsigned char*)element, list->element_size);
         }
-        current = current->next;
-        if (current != list->tail) {
+        if (++written < list->length) {
             // If separator contains a newline we just print it wholly; else we add separator then maybe newline later.
-            fputs(separator, file);
+            write_buffer_put(&out, separator, sep_len);
         }
     }
     // Ensure file ends with newline for POSIX friendliness if separator lacked one
-    size_t sep_len = strlen(separator);
     if (sep_len == 0 || separator[sep_len-1] != '\n') {
-        fputc('\n', file);
+        write_buffer_put_char(&out, '\n');
     }
-    fclose(file);
-    return LIST_SUCCESS;
+    write_buffer_flush(&out);
+    free(out.data);
+    if (fclose(file) != 0) out.failed = true;
+    return out.failed ? LIST_ERROR_IO : LIST_SUCCESS;
+}
+
+// Buffered text input for load_from_file(): the file is read TEXT_READ_BUFFER_BYTES at a time and
+// split into whitespace-delimited tokens in place, so there is no line-length limit and no stdio
+// call per token. Numbers are parsed by hand; only unusual doubles go through strtod().
+#define TEXT_READ_BUFFER_BYTES (1u << 20)
+
+typedef struct {
+    FILE* file;
+    char* data;           // capacity + 1 bytes: room to terminate a token in place
+    size_t capacity;
+    size_t start;         // Next unread byte
+    size_t end;           // End of the bytes read so far
+    size_t line;          // Position of data[start]
+    size_t column;
+    size_t token_line;    // Position of the last token returned
+    size_t token_column;
+    bool wide;            // Scan for delimiters 16 bytes at a time
+    bool at_eof;
+    ListResult result;    // LIST_ERROR_IO / LIST_ERROR_MEMORY_ALLOC once reading failed
+} TextReader;
+
+// INTERNAL HELPER FUNCTION: the characters isspace() accepts in the "C" locale
+static inline bool is_text_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// INTERNAL HELPER FUNCTION reading more of the file after the unread bytes, which are moved to
+// the front of the buffer (the buffer doubles when they already fill it). False at end of file.
+static bool text_reader_fill(TextReader* reader) {
+
+    if (reader->at_eof) return false;
+    size_t unread = reader->end - reader->start;
+    if (reader->start > 0) {
+        memmove(reader->data, reader->data + reader->start, unread);
+        reader->start = 0;
+        reader->end = unread;
+    }
+    if (reader->end == reader->capacity) {
+        char* grown = realloc(reader->data, reader->capacity * 2 + 1);
+        if (!grown) {
+            reader->result = LIST_ERROR_MEMORY_ALLOC;
+            reader->at_eof = true;
+            return false;
+        }
+        reader->data = grown;
+        reader->capacity *= 2;
+    }
+
+    size_t got = fread(reader->data + reader->end, 1, reader->capacity - reader->end, reader->file);
+    if (got == 0) {
+        if (ferror(reader->file)) reader->result = LIST_ERROR_IO;
+        reader->at_eof = true;
+        return false;
+    }
+    reader->end += got;
+    return true;
+}
+
+// INTERNAL HELPER FUNCTION returning the offset of the first whitespace in data[from, end), or end
+static size_t find_text_space(const TextReader* reader, size_t from, size_t end) {
+
+    const char* data = reader->data;
+#ifdef LIST_SIMD_X86
+    if (reader->wide) {
+        // Bytes <= ' ' are candidates (one unsigned compare); the exact test weeds out the rest
+        const __m128i space = _mm_set1_epi8(' ');
+        for (; end - from >= 16; from += 16) {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)(data + from));
+            unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(bytes, space), bytes));
+            for (; mask; mask &= mask - 1) {
+                size_t at = from + (size_t)__builtin_ctz(mask);
+                if (is_text_space(data[at])) return at;
+            }
+        }
+    }
+#endif
+    while (from < end && !is_text_space(data[from])) from++;
+    return from;
+}
+
+// INTERNAL HELPER FUNCTION returning the next whitespace-delimited token (false at end of file).
+// The token stays valid until the next call; its position is left in token_line/token_column.
+static bool text_next_token(TextReader* reader, char** token, size_t* length) {
+
+    for (;;) {
+        if (reader->start == reader->end && !text_reader_fill(reader)) return false;
+        char c = reader->data[reader->start];
+        if (!is_text_space(c)) break;
+        reader->start++;
+        if (c == '\n') {
+            reader->line++;
+            reader->column = 1;
+        } else {
+            reader->column++;
+        }
+    }
+
+    // A token running into the end of the buffer is completed from the next read
+    size_t stop = find_text_space(reader, reader->start, reader->end);
+    while (stop == reader->end) {
+        size_t scanned = stop - reader->start;
+        if (!text_reader_fill(reader)) {  // The token is moved to the front of the buffer either way
+            stop = reader->end;
+            break;
+        }
+        stop = find_text_space(reader, reader->start + scanned, reader->end);
+    }
+
+    *token = reader->data + reader->start;
+    *length = stop - reader->start;
+    reader->token_line = reader->line;
+    reader->token_column = reader->column;
+    reader->column += *length;
+    reader->start = stop;
+    return true;
+}
+
+// INTERNAL HELPER FUNCTION parsing [+-]digits into an int. Returns NULL or what is wrong.
+static const char* parse_int_token(const char* token, size_t length, int* out) {
+
+    const char* end = token + length;
+    bool negative = false;
+    if (token < end && (*token == '+' || *token == '-')) negative = (*token++ == '-');
+    if (token == end) return "expected an integer";
+
+    // Magnitude in an unsigned 64-bit value; anything past INT_MIN's magnitude is out of range
+    const uint64_t limit = negative ? (uint64_t)INT_MAX + 1 : (uint64_t)INT_MAX;
+    uint64_t magnitude = 0;
+    for (; token < end; token++) {
+        unsigned digit = (unsigned)(*token - '0');
+        if (digit > 9) return "expected an integer";
+        magnitude = magnitude * 10 + digit;
+        if (magnitude > limit) return "integer out of int range";
+    }
+    *out = negative ? (int)(0 - (int64_t)magnitude) : (int)magnitude;
+    return NULL;
+}
+
+// INTERNAL HELPER FUNCTION parsing a double with strtod() (inf, nan, hex floats, long mantissas).
+// The token is terminated in place for the call; the byte after it is restored.
+static const char* parse_double_slow(char* token, size_t length, double* out) {
+
+    char saved = token[length];
+    token[length] = '\0';
+    char* stop;
+    *out = strtod(token, &stop);
+    token[length] = saved;
+    return stop == token + length && length > 0 ? NULL : "expected a number";
+}
+
+// INTERNAL HELPER FUNCTION parsing a double, correctly rounded. Plain decimals whose digits fit
+// in 53 bits and whose power of ten is at most 1e22 are exact in double arithmetic, so one
+// multiply or divide gives the correctly rounded result (Clinger's fast path); strtod() does the rest.
+static const char* parse_double_token(char* token, size_t length, double* out) {
+
+#if FLT_EVAL_METHOD == 0
+    static const double powers_of_ten[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char* p = token;
+    const char* end = token + length;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) negative = (*p++ == '-');
+
+    uint64_t mantissa = 0;
+    int significant = 0;  // Digits in 'mantissa' (leading zeros excluded)
+    int exponent = 0;
+    bool any_digit = false;
+    bool fraction = false;
+    for (; p < end; p++) {
+        if (*p == '.' && !fraction) {
+            fraction = true;
+            continue;
+        }
+        unsigned digit = (unsigned)(*p - '0');
+        if (digit > 9) break;
+        any_digit = true;
+        if (fraction) exponent--;
+        if (mantissa == 0 && digit == 0) continue;
+        if (++significant > 19) return parse_double_slow(token, length, out);
+        mantissa = mantissa * 10 + digit;
+    }
+
+    if (any_digit && p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negative_exponent = false;
+        if (p < end && (*p == '+' || *p == '-')) negative_exponent = (*p++ == '-');
+        const char* digits = p;
+        int value = 0;
+        for (; p < end && (unsigned)(*p - '0') <= 9 && value < 10000; p++) value = value * 10 + (*p - '0');
+        if (p == digits) return parse_double_slow(token, length, out);
+        exponent += negative_exponent ? -value : value;
+    }
+
+    if (any_digit && p == end && mantissa <= (UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double value = (double)mantissa;
+        value = exponent < 0 ? value / powers_of_ten[-exponent] : value * powers_of_ten[exponent];
+        *out = negative ? -value : value;
+        return NULL;
+    }
+#endif
+    return parse_double_slow(token, length, out);
+}
+
+// INTERNAL HELPER FUNCTION parsing one or two hex digits (one byte of a hex dump)
+static const char* parse_hex_token(const char* token, size_t length, unsigned char* out) {
+
+    if (length == 0 || length > 2) return "expected a hex byte";
+    unsigned value = 0;
+    for (size_t i = 0; i < length; i++) {
+        char c = token[i];
+        unsigned digit;
+        if (c >= '0' && c <= '9') digit = (unsigned)(c - '0');
+        else if (c >= 'A' && c <= 'F') digit = (unsigned)(c - 'A' + 10);
+        else if (c >= 'a' && c <= 'f') digit = (unsigned)(c - 'a' + 10);
+        else return "expected a hex byte";
+        value = value * 16 + digit;
+    }
+    *out = (unsigned char)value;
+    return NULL;
+}
+
+// INTERNAL HELPER FUNCTION moving past 'count' bytes of the buffer, keeping the position current
+static void text_reader_advance(TextReader* reader, size_t count) {
+
+    const char* at = reader->data + reader->start;
+    const char* end = at + count;
+    const char* newline;
+    while ((newline = memchr(at, '\n', (size_t)(end - at))) != NULL) {
+        reader->line++;
+        reader->column = 1;
+        at = newline + 1;
+    }
+    reader->column += (size_t)(end - at);
+    reader->start += count;
+}
+
+// INTERNAL HELPER FUNCTION returning the offset of the first complete 'separator' in data[from, end),
+// or end
+static size_t find_separator(const char* data, size_t from, size_t end, const char* separator, size_t length) {
+
+    while (end - from >= length) {
+        const char* hit = memchr(data + from, separator[0], end - from - length + 1);
+        if (!hit) break;
+        if (memcmp(hit + 1, separator + 1, length - 1) == 0) return (size_t)(hit - data);
+        from = (size_t)(hit - data) + 1;
+    }
+    return end;
+}
+
+// INTERNAL HELPER FUNCTION finding the next field: the bytes from data[start] up to the next
+// 'separator' (or the end of the file), which are read in as needed. Sets the field's length and
+// the bytes to skip past it (separator included). False once the file is used up.
+static bool text_next_field(TextReader* reader, const char* separator, size_t separator_length,
+                            size_t* length, size_t* skip) {
+
+    if (reader->start == reader->end && !text_reader_fill(reader)) return false;
+
+    size_t from = reader->start;
+    for (;;) {
+        size_t found = find_separator(reader->data, from, reader->end, separator, separator_length);
+        if (found < reader->end) {
+            *length = found - reader->start;
+            *skip = *length + separator_length;
+            return true;
+        }
+        // A separator may straddle the refill: search its first bytes again
+        size_t searched = reader->end - reader->start;
+        searched = searched >= separator_length ? searched - (separator_length - 1) : 0;
+        if (!text_reader_fill(reader)) {
+            *length = *skip = reader->end - reader->start;
+            return true;
+        }
+        from = reader->start + searched;
+    }
+}
+
+// INTERNAL HELPER FUNCTION parsing an int or double token (by the list's element size) and
+// appending it. Returns NULL or what is wrong with the token.
+static const char* append_text_number(LinkedList* list, char* token, size_t length, ListResult* result) {
+
+    const char* problem;
+    if (list->element_size == sizeof(int)) {
+        int value;
+        problem = parse_int_token(token, length, &value);
+        if (!problem) *result = insert_tail_value_internal(list, &value);
+    } else {
+        double value;
+        problem = parse_double_token(token, length, &value);
+        if (!problem) *result = insert_tail_value_internal(list, &value);
+    }
+    return problem;
+}
+
+// INTERNAL HELPER FUNCTION for text loads: appends every element of 'file' to 'list' (ints,
+// doubles, single chars or hex dumps, by element size). A NULL/empty 'separator' means
+// whitespace-delimited tokens; otherwise each field between separators is one element.
+// Malformed input stops the load with LIST_ERROR_CORRUPT_DATA, its position noted for
+// load_from_file_error(). Memory stays at one read buffer whatever the file size.
+static ListResult load_text(LinkedList* list, FILE* file, const char* separator) {
+
+    TextReader reader = {
+        .file = file, .capacity = TEXT_READ_BUFFER_BYTES, .line = 1, .column = 1,
+        .wide = list_simd_level() >= LIST_SIMD_SSE2, .result = LIST_SUCCESS
+    };
+    size_t size = list->element_size;
+    bool hex = size != sizeof(char) && size != sizeof(int) && size != sizeof(double);
+    reader.data = malloc(reader.capacity + 1);
+    unsigned char* element = hex ? malloc(size) : NULL;  // Hex bytes of the element being read
+    ListResult result = reader.data && (element || !hex) ? LIST_SUCCESS : LIST_ERROR_MEMORY_ALLOC;
+    const char* problem = NULL;
+    size_t separator_length = separator ? strlen(separator) : 0;
+
+    if (result != LIST_SUCCESS) {
+        // Nothing to read into
+    } else if (separator_length > 0) {
+        size_t length;
+        size_t skip;
+        while (result == LIST_SUCCESS && !problem &&
+               text_next_field(&reader, separator, separator_length, &length, &skip)) {
+            // Surrounding whitespace is not part of the element (only line breaks for chars), and
+            // empty fields are skipped
+            char* field = reader.data + reader.start;
+            size_t lead = 0;
+            if (size == sizeof(char)) {
+                while (length > 0 && (field[length - 1] == '\n' || field[length - 1] == '\r')) length--;
+            } else {
+                while (lead < length && is_text_space(field[lead])) lead++;
+                while (length > lead && is_text_space(field[length - 1])) length--;
+            }
+            text_reader_advance(&reader, lead);
+            reader.token_line = reader.line;
+            reader.token_column = reader.column;
+            field += lead;
+            length -= lead;
+
+            if (length == 0) {
+                // Empty field
+            } else if (size == sizeof(char)) {
+                if (length == 1) result = insert_tail_value_internal(list, field);
+                else problem = "expected a single character";
+            } else if (!hex) {
+                problem = append_text_number(list, field, length, &result);
+            } else {
+                // Space separated hex bytes, exactly one element's worth
+                size_t filled = 0;
+                for (size_t i = 0; i < length && !problem; ) {
+                    size_t stop = i;
+                    while (stop < length && !is_text_space(field[stop])) stop++;
+                    if (filled == size) problem = "too many hex bytes for one element";
+                    else problem = parse_hex_token(field + i, stop - i, &element[filled++]);
+                    for (i = stop; i < length && is_text_space(field[i]); i++) {}
+                }
+                if (!problem && filled < size) problem = "too few hex bytes for one element";
+                if (!problem) result = insert_tail_value_internal(list, element);
+            }
+            text_reader_advance(&reader, skip - lead);
+        }
+    } else if (size == sizeof(char)) {
+        // Every character except line breaks is an element
+        while (result == LIST_SUCCESS && text_reader_fill(&reader)) {
+            for (; result == LIST_SUCCESS && reader.start < reader.end; reader.start++) {
+                char c = reader.data[reader.start];
+                if (c != '\n' && c != '\r') result = insert_tail_value_internal(list, &c);
+            }
+        }
+    } else {
+        char* token;
+        size_t length;
+        size_t filled = 0;
+        while (result == LIST_SUCCESS && !problem && text_next_token(&reader, &token, &length)) {
+            if (!hex) {
+                problem = append_text_number(list, token, length, &result);
+            } else {
+                problem = parse_hex_token(token, length, &element[filled]);
+                if (!problem && ++filled == size) {
+                    result = insert_tail_value_internal(list, element);
+                    filled = 0;
+                }
+            }
+        }
+        if (!problem && result == LIST_SUCCESS && reader.result == LIST_SUCCESS && filled > 0) {
+            problem = "incomplete element at end of file";
+        }
+    }
+
+    if (problem) {
+        note_load_error(LIST_ERROR_CORRUPT_DATA, reader.token_line, reader.token_column, problem);
+        result = LIST_ERROR_CORRUPT_DATA;
+    } else {
+        if (result == LIST_SUCCESS) result = reader.result;
+        if (result != LIST_SUCCESS) note_load_error(result, 0, 0, NULL);
+    }
+    free(element);
+    free(reader.data);
+    return result;
 }
 
 // load_from_file: unified binary/text loader.
-//   Binary: reads header then raw bytes.
+//   Binary: v2 files (blocks checked and read in parallel) or legacy files.
 //   Text: whitespace or custom separator parsing as described in header doc.
 LinkedList* load_from_file(const char* filename, size_t element_size, FileFormat format,
                            const char* separator,
                            PrintFunction print_fn, CompareFunction compare_fn,
                            FreeFunction free_fn, CopyFunction copy_fn) {
     (void)compare_fn; // comparator no longer stored; kept for backward signature compatibility
-    if (!filename) return NULL;
+    note_load_error(LIST_SUCCESS, 0, 0, NULL);
+    if (!filename) { note_load_error(LIST_ERROR_NULL_POINTER, 0, 0, NULL); return NULL; }
     if (format == FILE_FORMAT_BINARY) {
-        FILE* bfile = fopen(filename, "rb");
-        if (!bfile) return NULL;
-        size_t saved_length=0, saved_element_size=0;
-        if (fread(&saved_length, sizeof(size_t), 1, bfile) != 1 ||
-            fread(&saved_element_size, sizeof(size_t), 1, bfile) != 1) { fclose(bfile); return NULL; }
-        if (saved_element_size != element_size) { fclose(bfile); return NULL; }
-        LinkedList* blist = create_list(element_size);
-        if (!blist) { fclose(bfile); return NULL; }
+        LinkedList* blist = load_binary(filename, element_size, 0, SIZE_MAX);
+        if (!blist) return NULL;
         if (print_fn) set_print_function(blist, print_fn);
-    // compare_fn provided per call now (no stored comparator)
         if (free_fn) set_free_function(blist, free_fn);
         if (copy_fn) set_copy_function(blist, copy_fn);
-        for (size_t i=0;i<saved_length;i++) {
-            void* elem = malloc(element_size);
-            if (!elem || fread(elem, element_size, 1, bfile) != 1) { free(elem); destroy(blist); fclose(bfile); return NULL; }
-            if (insert_tail_value_internal(blist, elem) != LIST_SUCCESS) { free(elem); destroy(blist); fclose(bfile); return NULL; }
-            free(elem);
-        }
-        fclose(bfile);
         return blist;
     }
 
     FILE* file = fopen(filename, "r");
-    if (!file) return NULL;
+    if (!file) { note_load_error(LIST_ERROR_IO, 0, 0, "cannot open file"); return NULL; }
 
     LinkedList* list = create_list(element_size);
-    if (!list) { fclose(file); return NULL; }
+    if (!list) { note_load_error(LIST_ERROR_MEMORY_ALLOC, 0, 0, NULL); fclose(file); return NULL; }
     if (print_fn) set_print_function(list, print_fn);
     // compare_fn provided per call now (no stored comparator)
     if (free_fn) set_free_function(list, free_fn);
     if (copy_fn) set_copy_function(list, copy_fn);
 
-    // Determine actual separator behavior: if NULL fallback to whitespace tokenization (original behavior)
-    if (format == FILE_FORMAT_TEXT) {
-        if (!separator || separator[0] == '\0') {
-            // Legacy whitespace/newline parsing.
-            if (element_size == sizeof(int)) { // Parse each whitespace-delimited token as int
-                int value; while (fscanf(file, "%d", &value) == 1) {
-                    if (insert_tail_value_internal(list, &value) != LIST_SUCCESS) { destroy(list); fclose(file); return NULL; }
-                }
-            } else if (element_size == sizeof(double)) { // Parse double tokens
-                double dval; while (fscanf(file, "%lf", &dval) == 1) {
-                    if (insert_tail_value_internal(list, &dval) != LIST_SUCCESS) { destroy(list); fclose(file); return NULL; }
-                }
-            } else if (element_size == sizeof(char)) { // Read each non-newline char as element
-                int c; while ((c = fgetc(file)) != EOF) {
-                    if (c == '\n' || c == '\r') continue; char ch = (char)c;
-                    if (insert_tail_value_internal(list, &ch) != LIST_SUCCESS) { destroy(list); fclose(file); return NULL; }
-                }
-            } else {
-                unsigned char* buffer = (unsigned char*)malloc(element_size); // Temp buffer for hex bytes
-                if (!buffer) { destroy(list); fclose(file); return NULL; }
-                char line[4096];
-                while (fgets(line, sizeof(line), file)) {
-                    size_t count = 0; char* tok = strtok(line, " \t\r\n");
-                    while (tok && count < element_size) {
-                        unsigned int byteVal; if (sscanf(tok, "%02X", &byteVal) != 1) { break; }
-                        buffer[count++] = (unsigned char)byteVal; tok = strtok(NULL, " \t\r\n");
-                    }
-                    if (count == element_size) {
-                        if (insert_tail_value_internal(list, buffer) != LIST_SUCCESS) { free(buffer); destroy(list); fclose(file); return NULL; }
-                    }
-                }
-                free(buffer);
-            }
-        } else {
-            // Custom separator parsing: read entire file, split by exact separator string.
-            // Load whole file into memory (teaching simplification; not for huge files)
-            fseek(file, 0, SEEK_END); long fsize = ftell(file); if (fsize < 0) { destroy(list); fclose(file); return NULL; }
-            rewind(file);
-            char* content = (char*)malloc(fsize + 1);
-            if (!content) { destroy(list); fclose(file); return NULL; }
-            size_t read_bytes = fread(content, 1, fsize, file); content[read_bytes] = '\0';
-
-            size_t sep_len = strlen(separator); // We'll split by this exact substring
-            char* start = content; char* pos;
-            while ((pos = strstr(start, separator)) != NULL) {
-                *pos = '\0';
-                if (*start != '\0') { // Non-empty token
-                    if (element_size == sizeof(int)) {
-                        int v; if (sscanf(start, "%d", &v) == 1) {
-                            if (insert_tail_value_internal(list, &v) != LIST_SUCCESS) { free(content); destroy(list); fclose(file); return NULL; }
-                        }
-                    } else if (element_size == sizeof(double)) {
-                        double dv; if (sscanf(start, "%lf", &dv) == 1) {
-                            if (insert_tail_value_internal(list, &dv) != LIST_SUCCESS) { free(content); destroy(list); fclose(file); return NULL; }
-                        }
-                    } else if (element_size == sizeof(char)) {
-                        if (start[0] != '\0') {
-                            char ch = start[0];
-                            if (insert_tail_value_internal(list, &ch) != LIST_SUCCESS) { free(content); destroy(list); fclose(file); return NULL; }
-                        }
-                    } else {
-                        // Unsupported complex type for custom separator parsing; user should fall back to binary/hex whitespace mode.
-                    }
-                }
-                start = pos + sep_len;
-            }
-            // Last token
-            if (*start != '\0') { // Final token after last separator
-                if (element_size == sizeof(int)) {
-                    int v; if (sscanf(start, "%d", &v) == 1) {
-                        if (insert_tail_value_internal(list, &v) != LIST_SUCCESS) { free(content); destroy(list); fclose(file); return NULL; }
-                    }
-                } else if (element_size == sizeof(double)) {
-                    double dv; if (sscanf(start, "%lf", &dv) == 1) {
-                        if (insert_tail_value_internal(list, &dv) != LIST_SUCCESS) { free(content); destroy(list); fclose(file); return NULL; }
-                    }
-                } else if (element_size == sizeof(char)) {
-                    char ch = start[0]; if (insert_tail_value_internal(list, &ch) != LIST_SUCCESS) { free(content); destroy(list); fclose(file); return NULL; }
-                }
-            }
-            free(content);
-        }
+    // NULL/empty separator: whitespace-delimited tokens; otherwise one element per field
+    if (format == FILE_FORMAT_TEXT && load_text(list, file, separator) != LIST_SUCCESS) {
+        destroy(list);
+        fclose(file);
+        return NULL;
     }
 
     fclose(file);
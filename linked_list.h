@@ -25,6 +25,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // Portable-ish deprecation macro (compiler hint). Not critical if unsupported.
 #if defined(__GNUC__) || defined(__clang__)
@@ -61,7 +62,9 @@ typedef enum {
     LIST_ERROR_INVALID_OPERATION,   /**< Invalid operation for current state */
     LIST_ERROR_NO_COMPARE_FUNCTION, /**< Compare function required but not provided */
     LIST_ERROR_NO_PRINT_FUNCTION,   /**< Print function required but not provided */
-    LIST_ERROR_NO_FREE_FUNCTION     /**< Free function required but not provided */
+    LIST_ERROR_NO_FREE_FUNCTION,    /**< Free function required but not provided */
+    LIST_ERROR_IO,                  /**< File could not be read or written */
+    LIST_ERROR_CORRUPT_DATA         /**< File is damaged or not in a supported format */
 } ListResult;
 
 typedef enum {
@@ -87,6 +90,14 @@ typedef void (*PrintFunction)(void* data);
  */
 typedef int (*CompareFunction)(const void* data1, const void* data2);
 
+/**
+ * @brief A function pointer type for hashing an element.
+ * Elements that compare equal (CompareFunction returns 0) must produce the same hash.
+ * @param data A const void pointer to the element's data.
+ * @return The element's hash value.
+ */
+typedef size_t (*HashFunction)(const void* data);
+
 /**
  * @brief A function pointer type for freeing an element's data.
  * Required for complex data types that allocate memory internally (e.g., structs with pointers).
@@ -117,9 +128,19 @@ typedef bool (*FilterFunction)(const void* data);
  */
 typedef enum {
     LIST_MODE_VALUE,    /**< Copy data into list-managed memory. */
-    LIST_MODE_POINTER   /**< Store user-provided pointers directly. */
+    LIST_MODE_POINTER,  /**< Store user-provided pointers directly. */
+    LIST_MODE_BORROWED  /**< Data lives in memory the list does not own (a file mapping, see load_from_file_mmap). */
 } ListMemoryMode;
 
+/**
+ * @brief How a list lays out its elements in memory.
+ */
+typedef enum {
+    LIST_STORAGE_NODES,      /**< One node per element, linked both ways (create_list). */
+    LIST_STORAGE_CONTIGUOUS, /**< One growable array of elements (create_list_contiguous). */
+    LIST_STORAGE_UNROLLED    /**< Linked blocks of several elements each (create_list_unrolled). */
+} ListStorage;
+
 /**
  * @brief A function pointer type for transforming elements.
  * @param dest A void pointer to the destination for the transformed data.
@@ -139,10 +160,11 @@ typedef bool (*PredicateFunction)(const void* element);
  * @note Users of the library should not manipulate this structure directly.
  */
 typedef struct Node {
-    void* data;          /**< Pointer to the data stored in the node. */
+    void* data;          /**< Pointer to the data stored in the node (points at payload in value mode). */
     struct Node* next;   /**< Pointer to the next node in the list. */
     struct Node* prev;   /**< Pointer to the previous node in the list. */
-    ListMemoryMode mode; /**< How the data is managed: value copy (owned) or external pointer (ownership transferred). */
+    ListMemoryMode mode; /**< How the data is managed: value copy (owned), external pointer (ownership transferred) or borrowed. */
+    _Alignas(max_align_t) unsigned char payload[]; /**< Inline element storage, allocated with the node in value mode. */
 } Node;
 
 /**
@@ -164,8 +186,63 @@ typedef struct LinkedList {
     PrintFunction print_node_function;   /**< Function to print an element. */
     FreeFunction free_node_function;     /**< Function to free a complex element. */
     CopyFunction copy_node_function;     /**< Function to deep copy a complex element. */
+
+    // Memory management
+    struct NodePool* pool;     /**< Optional slab pool for nodes (NULL = one malloc per node). */
+    size_t pointer_nodes;      /**< Elements stored in LIST_MODE_POINTER (each owns an external block). */
+    struct FileMapping* mapping; /**< load_from_file_mmap(): mapped file holding the borrowed elements (NULL = none). */
+
+    // Positional lookup cache ("finger"): the last node found by index
+    Node* finger_node;         /**< Node found by the last index lookup (NULL = none cached). */
+    size_t finger_index;       /**< Index of finger_node. */
+    size_t finger_seq;         /**< Odd while a get() moves the finger (lets concurrent readers share it). */
+    size_t finger_lookups;     /**< Index lookups performed (see list_finger_stats()). */
+    size_t finger_hits;        /**< Lookups that walked from the finger instead of head/tail. */
+
+    // Optional positional index (see list_enable_index())
+    struct SkipIndex* skip_index; /**< Indexable skip list over the nodes (NULL = not indexed). */
+
+    size_t version;            /**< Bumped by every structural change (invalidates ListViews). */
+
+    // Storage layout (node-only features such as pools, cursors and views need LIST_STORAGE_NODES)
+    ListStorage storage;       /**< How elements are stored. */
+    unsigned char* elements;   /**< Contiguous storage: the element buffer (NULL until needed). */
+    size_t capacity;           /**< Contiguous storage: element slots in the buffer. */
+    size_t first_slot;         /**< Contiguous storage: slot of element 0 (free slots before it make head inserts cheap). */
+    size_t block_capacity;     /**< Unrolled storage: elements per block. */
 } LinkedList;
 
+/**
+ * @brief Hit rate of the positional lookup cache (see list_finger_stats()).
+ */
+typedef struct {
+    size_t lookups;     /**< Index lookups performed. */
+    size_t finger_hits; /**< Lookups that started from the finger. */
+    double hit_rate;    /**< finger_hits / lookups (0 when there were no lookups). */
+} ListFingerStats;
+
+/**
+ * @brief Size of a list's positional index (see list_index_stats()).
+ */
+typedef struct {
+    bool enabled;             /**< Whether the list is in indexed mode. */
+    size_t levels;            /**< Express lanes currently in use. */
+    size_t towers;            /**< Nodes that carry express-lane links. */
+    size_t bytes;             /**< Heap memory held by the index. */
+    double bytes_per_element; /**< bytes / length (0 for an empty list). */
+} ListIndexStats;
+
+/**
+ * @brief Counters describing a list's node pool (see list_pool_stats()).
+ */
+typedef struct {
+    size_t chunks;         /**< Number of chunks currently allocated. */
+    size_t live_nodes;     /**< Nodes in use by the list. */
+    size_t free_nodes;     /**< Slots ready for reuse (recycled or never used). */
+    size_t node_size;      /**< Bytes per slot (node header plus element). */
+    size_t bytes_reserved; /**< Total bytes held by the pool's chunks. */
+} ListPoolStats;
+
 
 ///////
 // 0 //
@@ -179,6 +256,8 @@ const char* error_string(ListResult result);
 ///////
 // Lifecycle Functions
 LinkedList* create_list(size_t element_size);
+LinkedList* create_list_contiguous(size_t element_size);
+LinkedList* create_list_unrolled(size_t element_size, size_t block_bytes);
 
 
 ///////
@@ -201,6 +280,14 @@ void set_list_struct_name(LinkedList* list, const char* struct_name);
 
 // Size and Overwrite Management
 ListResult set_max_size(LinkedList* list, size_t max_size, OverflowBehavior behavior);
+ListResult set_ring_buffer(LinkedList* list, size_t capacity);
+ListResult list_reserve(LinkedList* list, size_t capacity);
+
+// Node Pool (opt-in slab allocator; enable/disable only while the list is empty)
+ListResult list_enable_pool(LinkedList* list, size_t nodes_per_chunk);
+ListResult list_disable_pool(LinkedList* list);
+ListResult list_shrink_pool(LinkedList* list);
+ListResult list_pool_stats(const LinkedList* list, ListPoolStats* out_stats);
 
 ///////
 // 3 //
@@ -211,6 +298,7 @@ ListResult insert_head_value_internal(LinkedList* list, void* data);
 ListResult insert_tail_value_internal(LinkedList* list, void* data);
 ListResult insert_index_value_internal(LinkedList* list, size_t index, void* data);
 
+// Pointer mode keeps the caller's block: node storage only (LIST_ERROR_INVALID_OPERATION otherwise)
 ListResult insert_head_ptr(LinkedList* list, void* data_ptr);
 ListResult insert_tail_ptr(LinkedList* list, void* data_ptr);
 ListResult insert_index_ptr(LinkedList* list, size_t index, void* data_ptr);
@@ -244,6 +332,15 @@ ListResult print_list_advanced(const LinkedList* list, bool show_size, bool show
 
 void* get(const LinkedList* list, size_t index);
 
+// Positional lookup cache statistics (get/set_field/set_node/delete_index/insert_index)
+ListResult list_finger_stats(const LinkedList* list, ListFingerStats* out_stats);
+void list_reset_finger_stats(LinkedList* list);
+
+// Indexed mode: O(log n) get/insert_index/delete_index on large lists (off by default)
+ListResult list_enable_index(LinkedList* list);
+ListResult list_disable_index(LinkedList* list);
+ListResult list_index_stats(const LinkedList* list, ListIndexStats* out_stats);
+
 int index_of(const LinkedList* list, PredicateFunction predicate);
 int index_of_advanced(const LinkedList* list, Direction direction, PredicateFunction predicate);
 
@@ -337,12 +434,110 @@ ListResult set_node_ptr_impl(LinkedList* list, size_t index, void* new_value);
         set_node_ptr_impl(list, index, new_value_ptr) : \
         (printf("Error: Unsupported struct type: %s\n", (list)->struct_name), LIST_ERROR_INVALID_OPERATION)
 
+// Cursor Functions (O(1) traversal and in-place editing)
+
+/**
+ * @brief A position inside a list, for linear scans and in-place edits without get(list, i).
+ *
+ * A forward cursor (cursor_begin) walks towards the tail, a reverse cursor (cursor_rbegin)
+ * walks towards the head. A cursor stays valid across insertions and deletions made through
+ * it; other changes to the list (e.g. deleting its element or sorting) invalidate it.
+ */
+typedef struct {
+    LinkedList* list;    /**< The list being traversed. */
+    Node* node;          /**< Current node (a boundary node once the cursor runs off an end). */
+    size_t index;        /**< Index of the current node (within the view for view cursors). */
+    Direction direction; /**< START_FROM_HEAD = forward cursor, START_FROM_TAIL = reverse cursor. */
+    Node* before_first;  /**< Node in front of the traversed range (the dummy head for a whole list). */
+    Node* after_last;    /**< Node after the traversed range (the dummy tail for a whole list). */
+    bool read_only;      /**< Cursors over a ListView cannot insert or erase. */
+} ListCursor;
+
+ListCursor cursor_begin(LinkedList* list);
+ListCursor cursor_rbegin(LinkedList* list);
+bool cursor_valid(const ListCursor* cursor);
+void* cursor_peek(const ListCursor* cursor);
+size_t cursor_index(const ListCursor* cursor);
+bool cursor_next(ListCursor* cursor);
+bool cursor_prev(ListCursor* cursor);
+ListResult cursor_insert_before(ListCursor* cursor, void* data);
+ListResult cursor_insert_after(ListCursor* cursor, void* data);
+ListResult cursor_insert_before_ptr(ListCursor* cursor, void* data_ptr);
+ListResult cursor_insert_after_ptr(ListCursor* cursor, void* data_ptr);
+ListResult cursor_erase(ListCursor* cursor);
+
+// Slice Views (read-only windows into a list, nothing copied)
+
+/**
+ * @brief A read-only window [start, end) of a list, referenced by its boundary nodes.
+ *
+ * Any structural change to the parent list (insert, delete, sort, ...) invalidates the view;
+ * view functions then fail (NULL / 0 / error). Changing element values through the parent does not.
+ */
+typedef struct {
+    const LinkedList* list; /**< Parent list. */
+    Node* first;            /**< First node of the view (equals 'end' for an empty view). */
+    Node* end;              /**< Node just past the view (a real node or the parent's dummy tail). */
+    size_t start;           /**< Index of 'first' in the parent. */
+    size_t length;          /**< Number of elements in the view. */
+    size_t version;         /**< Parent version the view was taken at. */
+} ListView;
+
+ListResult list_view(const LinkedList* list, size_t start, size_t end, ListView* out_view);
+bool view_is_valid(const ListView* view);
+size_t view_count_matching(const ListView* view, PredicateFunction predicate);
+void* view_min_by(const ListView* view, CompareFunction compare_fn);
+void* view_max_by(const ListView* view, CompareFunction compare_fn);
+void* view_to_array(const ListView* view, size_t* out_size);
+LinkedList* view_filter(const ListView* view, FilterFunction filter_fn);
+LinkedList* view_map(const ListView* view, MapFunction map_fn, size_t new_element_size);
+ListCursor view_cursor_begin(const ListView* view);
+ListCursor view_cursor_rbegin(const ListView* view);
+
+// Lazy Pipelines (filter/map/take/skip stages run in a single pass, only the result is built)
+
+/**
+ * @brief A function pointer type for folding elements into an accumulator.
+ * @param accumulator The caller's accumulator (initialized by the caller before the fold).
+ * @param element A const void pointer to the current element.
+ */
+typedef void (*ReduceFunction)(void* accumulator, const void* element);
+
+typedef struct ListPipeline ListPipeline;
+
+ListPipeline* pipeline_from_list(const LinkedList* list);
+ListPipeline* pipeline_from_view(const ListView* view);
+ListResult pipeline_filter(ListPipeline* pipeline, FilterFunction filter_fn);
+ListResult pipeline_map(ListPipeline* pipeline, MapFunction map_fn, size_t new_element_size);
+ListResult pipeline_take(ListPipeline* pipeline, size_t count);
+ListResult pipeline_skip(ListPipeline* pipeline, size_t count);
+LinkedList* pipeline_collect(ListPipeline* pipeline);
+size_t pipeline_count(ListPipeline* pipeline);
+ListResult pipeline_reduce(ListPipeline* pipeline, ReduceFunction reduce_fn, void* accumulator);
+ListResult pipeline_min(ListPipeline* pipeline, CompareFunction compare_fn, void* out_element);
+ListResult pipeline_max(ListPipeline* pipeline, CompareFunction compare_fn, void* out_element);
+void pipeline_destroy(ListPipeline* pipeline);
+
 ///////
 // 7 //
 ///////
 // Sorting and Manipulation Functions
 ListResult sort_list(LinkedList* list, CompareFunction compare_fn);
 
+// Radix sort by an integer key inside each element (stable, no compare function).
+// Example: sort_list_by_key(people, offsetof(Person, id), sizeof(int), true)
+ListResult sort_list_by_key(LinkedList* list, size_t key_offset, size_t key_width, bool is_signed);
+#define sort_list_by_field(list, struct_type, field_name, is_signed) \
+    sort_list_by_key((list), offsetof(struct_type, field_name), sizeof(((struct_type*)0)->field_name), (is_signed))
+
+// Multi-threaded merge sort (same stable result as sort_list; compare_fn must be thread-safe)
+ListResult sort_list_parallel(LinkedList* list, CompareFunction compare_fn, size_t nthreads);
+
+// Selection without a full sort (same order as sort_list for the selected elements)
+LinkedList* top_k(const LinkedList* list, size_t k, CompareFunction compare_fn);
+ListResult partial_sort_list(LinkedList* list, size_t k, CompareFunction compare_fn);
+ListResult nth_element(LinkedList* list, size_t n, CompareFunction compare_fn);
+
 ///////
 // 8 //
 ///////
@@ -350,6 +545,10 @@ ListResult sort_list(LinkedList* list, CompareFunction compare_fn);
 LinkedList* copy(const LinkedList* list);
 ListResult extend(LinkedList* list, const LinkedList* other);
 LinkedList* concat(const LinkedList* list1, const LinkedList* list2);
+
+// Moving elements between lists (nodes are relinked, not copied)
+ListResult extend_move(LinkedList* list, LinkedList* other);
+ListResult splice_range(LinkedList* dest, size_t dest_pos, LinkedList* src, size_t start, size_t end);
 LinkedList* slice(const LinkedList* list, size_t start, size_t end);
 ListResult rotate(LinkedList* list, int positions);
 ListResult reverse(LinkedList* list);
@@ -366,6 +565,56 @@ LinkedList* unique_advanced(const LinkedList* list, CompareFunction compare_fn,
 LinkedList* intersection(const LinkedList* list1, const LinkedList* list2, CompareFunction compare_fn);
 LinkedList* union_lists(const LinkedList* list1, const LinkedList* list2, CompareFunction compare_fn);
 
+// Hash-based variants: same results and ordering, O(n + m) instead of O(n * m)
+LinkedList* unique_hashed(const LinkedList* list, HashFunction hash_fn, CompareFunction compare_fn);
+LinkedList* unique_advanced_hashed(const LinkedList* list, HashFunction hash_fn, CompareFunction compare_fn, Direction order);
+LinkedList* intersection_hashed(const LinkedList* list1, const LinkedList* list2, HashFunction hash_fn, CompareFunction compare_fn);
+LinkedList* union_lists_hashed(const LinkedList* list1, const LinkedList* list2, HashFunction hash_fn, CompareFunction compare_fn);
+
+// Sorted-merge variants: both lists sorted by compare_fn, one O(n + m) pass, sorted result.
+// With move_nodes the result takes over the chosen nodes from the sources instead of copying them.
+LinkedList* intersection_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes);
+LinkedList* union_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes);
+LinkedList* difference_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes);
+LinkedList* symmetric_difference_sorted(LinkedList* list1, LinkedList* list2, CompareFunction compare_fn, bool move_nodes);
+
+// Numeric functions for lists of int32_t, int64_t, float or double (element_size must match).
+// Contiguous and unrolled lists are scanned block by block with SSE2/AVX2 kernels when the CPU
+// has them; node lists work too, one element at a time. NaNs never match and are skipped by min/max.
+typedef enum {
+    LIST_SIMD_SCALAR = 0, /**< Portable loops. */
+    LIST_SIMD_SSE2,       /**< 128-bit x86 kernels (int64 lists use the portable loops). */
+    LIST_SIMD_AVX2        /**< 256-bit x86 kernels. */
+} ListSimdLevel;
+
+ListSimdLevel list_simd_level(void);
+ListResult list_set_simd_level(ListSimdLevel level);
+
+int list_find_i32(const LinkedList* list, int32_t value);
+int list_find_i64(const LinkedList* list, int64_t value);
+int list_find_f32(const LinkedList* list, float value);
+int list_find_f64(const LinkedList* list, double value);
+
+size_t list_count_in_range_i32(const LinkedList* list, int32_t low, int32_t high);
+size_t list_count_in_range_i64(const LinkedList* list, int64_t low, int64_t high);
+size_t list_count_in_range_f32(const LinkedList* list, float low, float high);
+size_t list_count_in_range_f64(const LinkedList* list, double low, double high);
+
+ListResult list_min_max_i32(const LinkedList* list, int32_t* out_min, int32_t* out_max);
+ListResult list_min_max_i64(const LinkedList* list, int64_t* out_min, int64_t* out_max);
+ListResult list_min_max_f32(const LinkedList* list, float* out_min, float* out_max);
+ListResult list_min_max_f64(const LinkedList* list, double* out_min, double* out_max);
+
+ListResult list_sum_i32(const LinkedList* list, int64_t* out_sum);
+ListResult list_sum_i64(const LinkedList* list, int64_t* out_sum);
+ListResult list_sum_f32(const LinkedList* list, double* out_sum);
+ListResult list_sum_f64(const LinkedList* list, double* out_sum);
+
+LinkedList* list_filter_greater_i32(const LinkedList* list, int32_t threshold);
+LinkedList* list_filter_greater_i64(const LinkedList* list, int64_t threshold);
+LinkedList* list_filter_greater_f32(const LinkedList* list, float threshold);
+LinkedList* list_filter_greater_f64(const LinkedList* list, double threshold);
+
 // Array to List Conversion Functions
 ListResult from_array(LinkedList* list, const void* arr, size_t n);
 void* to_array(const LinkedList* list, size_t* out_size);
@@ -378,25 +627,50 @@ char* to_string(const LinkedList* list, const char* separator);
 
 // File formats for persistence
 typedef enum {
-    FILE_FORMAT_BINARY = 0,  // Existing binary format
+    FILE_FORMAT_BINARY = 0,  // Versioned binary format (v2; legacy files still load)
     FILE_FORMAT_TEXT   = 1   // Human-readable text (one element per line)
 } FileFormat;
 
 // save_to_file / load_from_file (unified API):
-//   format == FILE_FORMAT_BINARY -> binary layout: [size_t length][size_t element_size][raw bytes...]
+//   format == FILE_FORMAT_BINARY -> v2 binary layout: little-endian header with magic "LLISTBIN",
+//                                   blocks of about 1 MiB of elements (each with a CRC32C), and a
+//                                   trailing block index. Legacy files ([size_t length][size_t
+//                                   element_size][raw bytes...]) are still accepted by the loaders.
 //   format == FILE_FORMAT_TEXT   -> human readable tokens.
 // TEXT MODE RULES:
 //   * Primitive element sizes (int/double/char) -> printed plainly.
 //   * Other sizes -> hex dump (space separated bytes) when using whitespace tokenization.
 //   * 'separator' (default "\n") placed BETWEEN elements. If NULL/empty during load -> whitespace mode.
-//   * Custom separator load currently supports only primitive types (no hex parsing there).
-// Portability: binary not endian/size_t portable (demo/educational). For production add magic header + fixed widths.
+//   * Whitespace mode has no line-length limit; a hex dump is read as a stream of byte tokens,
+//     element_size bytes per element. A malformed token fails the load (see load_from_file_error).
+//   * Custom separator load streams the file (one 1 MiB buffer, any file size): each field between
+//     separators is one element, surrounding whitespace ignored; other sizes take a hex dump per field.
+// Portability: binary header fields are fixed-width little-endian; element bytes are stored as they
+//   are in memory, so files only move between machines with the same byte order and struct layout.
 ListResult save_to_file(const LinkedList* list, const char* filename, FileFormat format, const char* separator);
 LinkedList* load_from_file(const char* filename, size_t element_size, FileFormat format,
                            const char* separator,
                            PrintFunction print_fn, CompareFunction compare_fn,
                            FreeFunction free_fn, CopyFunction copy_fn);
 
+// Why the calling thread's last load_from_file / load_range_from_file / load_from_file_mmap
+// returned NULL. Malformed text is LIST_ERROR_CORRUPT_DATA with the position of the bad token.
+typedef struct {
+    ListResult result;    // LIST_SUCCESS if the last load worked
+    size_t line;          // 1-based line and byte column of the bad token (0 = not a parse error)
+    size_t column;
+    const char* message;  // Static description of the problem, or NULL
+} ListLoadError;
+ListLoadError load_from_file_error(void);
+
+// Binary files: check every checksum without loading, or load only elements [start, start + count)
+ListResult verify_list_file(const char* filename);
+LinkedList* load_range_from_file(const char* filename, size_t element_size, size_t start, size_t count);
+
+// Maps a binary file into memory instead of reading it: nodes point straight into the mapping
+// (LIST_MODE_BORROWED), which is unmapped by destroy(). Checksums are not verified (see verify_list_file).
+LinkedList* load_from_file_mmap(const char* filename, size_t element_size);
+
 // Convenience Macros for Passing Values Directly
 
 /**
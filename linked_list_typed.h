@@ -0,0 +1,349 @@
+/**
+ * @file linked_list_typed.h
+ * @brief Header-only generator for type-specialized doubly linked lists.
+ *
+ * The generic LinkedList stores everything behind void* and element_size, and calls
+ * the compare/predicate functions through pointers, so the compiler can neither
+ * inline the comparisons nor use a fixed element size. LL_DEFINE_TYPED_LIST() stamps
+ * out a small list type for one element type instead: the element lives inside the
+ * node as a real T, copies are plain assignments and the comparison is expanded
+ * inline into sort/find/min/max.
+ *
+ * Usage:
+ *   LL_DEFINE_TYPED_LIST(IntList, int, LL_COMPARE_VALUES(*a, *b))
+ *   LL_DEFINE_TYPED_LIST(PersonList, Person, LL_COMPARE_VALUES(a->id, b->id))
+ *
+ *   IntList* numbers = IntList_create();
+ *   IntList_insert_tail(numbers, 42);
+ *   IntList_sort(numbers);
+ *   int index = IntList_find(numbers, 42);
+ *   IntList_destroy(numbers);
+ *
+ * 'cmp_expr' is an expression over 'a' and 'b' (both const T*) that evaluates to
+ * less than, equal to, or greater than zero, like a CompareFunction.
+ *
+ * Generated for LL_DEFINE_TYPED_LIST(name, T, cmp_expr):
+ *   name* name_create(void);                    void name_destroy(name* list);
+ *   void name_clear(name* list);                size_t name_length(const name* list);
+ *   ListResult name_insert_head(name* list, T value);
+ *   ListResult name_insert_tail(name* list, T value);
+ *   ListResult name_insert_index(name* list, size_t index, T value);
+ *   ListResult name_delete_head(name* list);    ListResult name_delete_tail(name* list);
+ *   ListResult name_delete_index(name* list, size_t index);
+ *   T* name_get(const name* list, size_t index);
+ *   ListResult name_sort(name* list);           (stable merge sort, nodes are relinked)
+ *   int name_find(const name* list, T value);   (first index comparing equal, or a negative error code)
+ *   size_t name_count(const name* list, T value);
+ *   T* name_min(const name* list);              T* name_max(const name* list);
+ *   T* name_to_array(const name* list, size_t* out_size);
+ *   name* name_from_array(const T* array, size_t n);
+ *   LinkedList* name_to_list(const name* list); (generic copy, any further API applies)
+ *   name* name_from_list(const LinkedList* list);
+ *   int name_compare(const void* data1, const void* data2); (cmp_expr as a CompareFunction)
+ *
+ * Elements are copied by assignment and never freed one by one, so T should not own
+ * heap memory (use the generic LinkedList with a free function for that).
+ */
+
+#ifndef LINKED_LIST_TYPED_H
+#define LINKED_LIST_TYPED_H
+
+#include <stdlib.h>
+#include "linked_list.h"
+
+/**
+ * @brief Three-way comparison of two scalar values (-1, 0 or 1), safe from overflow.
+ * Handy as (part of) a cmp_expr: LL_COMPARE_VALUES(*a, *b) or LL_COMPARE_VALUES(a->id, b->id).
+ */
+#define LL_COMPARE_VALUES(x, y) (((x) > (y)) - ((x) < (y)))
+
+#define LL_DEFINE_TYPED_LIST(name, T, cmp_expr)                                               \
+                                                                                              \
+typedef struct name##_node {                                                                  \
+    struct name##_node* next;                                                                 \
+    struct name##_node* prev;                                                                 \
+    T value;                                                                                  \
+} name##_node;                                                                                \
+                                                                                              \
+typedef struct name {                                                                         \
+    name##_node* head;  /* dummy head node */                                                 \
+    name##_node* tail;  /* dummy tail node */                                                 \
+    size_t length;                                                                            \
+} name;                                                                                       \
+                                                                                              \
+static inline int name##_compare_values(const T* a, const T* b) {                             \
+    return (cmp_expr);                                                                        \
+}                                                                                             \
+                                                                                              \
+static inline int name##_compare(const void* data1, const void* data2) {                      \
+    return name##_compare_values((const T*)data1, (const T*)data2);                           \
+}                                                                                             \
+                                                                                              \
+static inline name* name##_create(void) {                                                     \
+    name* list = malloc(sizeof(name));                                                        \
+    if (!list) return NULL;                                                                   \
+    list->head = calloc(1, sizeof(name##_node));                                              \
+    list->tail = calloc(1, sizeof(name##_node));                                              \
+    if (!list->head || !list->tail) {                                                         \
+        free(list->head);                                                                     \
+        free(list->tail);                                                                     \
+        free(list);                                                                           \
+        return NULL;                                                                          \
+    }                                                                                         \
+    list->head->next = list->tail;                                                            \
+    list->tail->prev = list->head;                                                            \
+    list->length = 0;                                                                         \
+    return list;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline void name##_clear(name* list) {                                                 \
+    if (!list) return;                                                                        \
+    name##_node* current = list->head->next;                                                  \
+    while (current != list->tail) {                                                           \
+        name##_node* next = current->next;                                                    \
+        free(current);                                                                        \
+        current = next;                                                                       \
+    }                                                                                         \
+    list->head->next = list->tail;                                                            \
+    list->tail->prev = list->head;                                                            \
+    list->length = 0;                                                                         \
+}                                                                                             \
+                                                                                              \
+static inline void name##_destroy(name* list) {                                               \
+    if (!list) return;                                                                        \
+    name##_clear(list);                                                                       \
+    free(list->head);                                                                         \
+    free(list->tail);                                                                         \
+    free(list);                                                                               \
+}                                                                                             \
+                                                                                              \
+static inline size_t name##_length(const name* list) {                                        \
+    return list ? list->length : 0;                                                           \
+}                                                                                             \
+                                                                                              \
+/* Links a new node holding 'value' right before 'position' */                                \
+static inline ListResult name##_link_before(name* list, name##_node* position, T value) {    \
+    name##_node* node = malloc(sizeof(name##_node));                                          \
+    if (!node) return LIST_ERROR_MEMORY_ALLOC;                                                \
+    node->value = value;                                                                      \
+    node->next = position;                                                                    \
+    node->prev = position->prev;                                                              \
+    position->prev->next = node;                                                              \
+    position->prev = node;                                                                    \
+    list->length++;                                                                           \
+    return LIST_SUCCESS;                                                                      \
+}                                                                                             \
+                                                                                              \
+static inline void name##_unlink(name* list, name##_node* node) {                             \
+    node->prev->next = node->next;                                                            \
+    node->next->prev = node->prev;                                                            \
+    free(node);                                                                               \
+    list->length--;                                                                           \
+}                                                                                             \
+                                                                                              \
+/* Walks from whichever end is closer; index must be < length */                             \
+static inline name##_node* name##_node_at(const name* list, size_t index) {                   \
+    name##_node* current;                                                                     \
+    if (index < list->length / 2) {                                                           \
+        current = list->head->next;                                                           \
+        for (size_t i = 0; i < index; i++) current = current->next;                           \
+    } else {                                                                                  \
+        current = list->tail->prev;                                                           \
+        for (size_t i = list->length - 1; i > index; i--) current = current->prev;            \
+    }                                                                                         \
+    return current;                                                                           \
+}                                                                                             \
+                                                                                              \
+static inline ListResult name##_insert_head(name* list, T value) {                            \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    return name##_link_before(list, list->head->next, value);                                 \
+}                                                                                             \
+                                                                                              \
+static inline ListResult name##_insert_tail(name* list, T value) {                            \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    return name##_link_before(list, list->tail, value);                                       \
+}                                                                                             \
+                                                                                              \
+static inline ListResult name##_insert_index(name* list, size_t index, T value) {             \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    if (index > list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;                          \
+    name##_node* position = (index == list->length) ? list->tail : name##_node_at(list, index); \
+    return name##_link_before(list, position, value);                                         \
+}                                                                                             \
+                                                                                              \
+static inline ListResult name##_delete_head(name* list) {                                     \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    if (list->length == 0) return LIST_ERROR_INVALID_OPERATION;                               \
+    name##_unlink(list, list->head->next);                                                    \
+    return LIST_SUCCESS;                                                                      \
+}                                                                                             \
+                                                                                              \
+static inline ListResult name##_delete_tail(name* list) {                                     \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    if (list->length == 0) return LIST_ERROR_INVALID_OPERATION;                               \
+    name##_unlink(list, list->tail->prev);                                                    \
+    return LIST_SUCCESS;                                                                      \
+}                                                                                             \
+                                                                                              \
+static inline ListResult name##_delete_index(name* list, size_t index) {                      \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    if (index >= list->length) return LIST_ERROR_INDEX_OUT_OF_BOUNDS;                         \
+    name##_unlink(list, name##_node_at(list, index));                                         \
+    return LIST_SUCCESS;                                                                      \
+}                                                                                             \
+                                                                                              \
+static inline T* name##_get(const name* list, size_t index) {                                 \
+    if (!list || index >= list->length) return NULL;                                          \
+    return &name##_node_at(list, index)->value;                                               \
+}                                                                                             \
+                                                                                              \
+/* Merges two sorted NULL-terminated chains; ties take the node from 'left' (stable) */       \
+static inline name##_node* name##_merge_chains(name##_node* left, name##_node* right) {       \
+    name##_node* merged = NULL;                                                               \
+    name##_node** link = &merged;                                                             \
+    while (left && right) {                                                                   \
+        if (name##_compare_values(&right->value, &left->value) < 0) {                         \
+            *link = right;                                                                    \
+            right = right->next;                                                              \
+        } else {                                                                              \
+            *link = left;                                                                     \
+            left = left->next;                                                                \
+        }                                                                                     \
+        link = &(*link)->next;                                                                \
+    }                                                                                         \
+    *link = left ? left : right;                                                              \
+    return merged;                                                                            \
+}                                                                                             \
+                                                                                              \
+/* Same bottom-up merge sort as sort_list(): bins[i] holds a sorted run of 2^i nodes */       \
+static inline ListResult name##_sort(name* list) {                                            \
+    if (!list) return LIST_ERROR_NULL_POINTER;                                                \
+    if (list->length <= 1) return LIST_SUCCESS;                                               \
+                                                                                              \
+    name##_node* first = list->head->next;                                                    \
+    list->tail->prev->next = NULL;                                                            \
+                                                                                              \
+    name##_node* bins[64] = { NULL };                                                         \
+    size_t used_bins = 0;                                                                     \
+    while (first) {                                                                           \
+        name##_node* carry = first;                                                           \
+        first = first->next;                                                                  \
+        carry->next = NULL;                                                                   \
+        size_t i = 0;                                                                         \
+        while (i < used_bins && bins[i]) {                                                    \
+            carry = name##_merge_chains(bins[i], carry);                                      \
+            bins[i] = NULL;                                                                   \
+            i++;                                                                              \
+        }                                                                                     \
+        bins[i] = carry;                                                                      \
+        if (i == used_bins) used_bins++;                                                      \
+    }                                                                                         \
+    name##_node* sorted = NULL;                                                               \
+    for (size_t i = 0; i < used_bins; i++) {                                                  \
+        if (bins[i]) sorted = sorted ? name##_merge_chains(bins[i], sorted) : bins[i];        \
+    }                                                                                         \
+                                                                                              \
+    /* Rebuild the prev links and re-attach the dummy nodes */                                \
+    name##_node* prev_node = list->head;                                                      \
+    for (name##_node* current = sorted; current; current = current->next) {                   \
+        prev_node->next = current;                                                            \
+        current->prev = prev_node;                                                            \
+        prev_node = current;                                                                  \
+    }                                                                                         \
+    prev_node->next = list->tail;                                                             \
+    list->tail->prev = prev_node;                                                             \
+    return LIST_SUCCESS;                                                                      \
+}                                                                                             \
+                                                                                              \
+static inline int name##_find(const name* list, T value) {                                    \
+    if (!list) return -LIST_ERROR_NULL_POINTER;                                               \
+    int index = 0;                                                                            \
+    for (name##_node* current = list->head->next; current != list->tail; current = current->next) { \
+        if (name##_compare_values(&current->value, &value) == 0) return index;                \
+        index++;                                                                              \
+    }                                                                                         \
+    return -LIST_ERROR_ELEMENT_NOT_FOUND;                                                     \
+}                                                                                             \
+                                                                                              \
+static inline size_t name##_count(const name* list, T value) {                                \
+    if (!list) return 0;                                                                      \
+    size_t count = 0;                                                                         \
+    for (name##_node* current = list->head->next; current != list->tail; current = current->next) { \
+        count += (name##_compare_values(&current->value, &value) == 0);                       \
+    }                                                                                         \
+    return count;                                                                             \
+}                                                                                             \
+                                                                                              \
+/* First extreme element in list order: sign < 0 finds the minimum, > 0 the maximum */        \
+static inline T* name##_extreme(const name* list, int sign) {                                 \
+    if (!list || list->length == 0) return NULL;                                              \
+    name##_node* best = list->head->next;                                                     \
+    for (name##_node* current = best->next; current != list->tail; current = current->next) { \
+        if (sign * name##_compare_values(&current->value, &best->value) > 0) best = current;  \
+    }                                                                                         \
+    return &best->value;                                                                      \
+}                                                                                             \
+                                                                                              \
+static inline T* name##_min(const name* list) {                                               \
+    return name##_extreme(list, -1);                                                          \
+}                                                                                             \
+                                                                                              \
+static inline T* name##_max(const name* list) {                                               \
+    return name##_extreme(list, 1);                                                           \
+}                                                                                             \
+                                                                                              \
+/* Caller must free the returned array */                                                     \
+static inline T* name##_to_array(const name* list, size_t* out_size) {                        \
+    if (out_size) *out_size = 0;                                                              \
+    if (!list || list->length == 0) return NULL;                                              \
+    T* array = malloc(list->length * sizeof(T));                                              \
+    if (!array) return NULL;                                                                  \
+    size_t i = 0;                                                                             \
+    for (name##_node* current = list->head->next; current != list->tail; current = current->next) { \
+        array[i++] = current->value;                                                          \
+    }                                                                                         \
+    if (out_size) *out_size = i;                                                              \
+    return array;                                                                             \
+}                                                                                             \
+                                                                                              \
+static inline name* name##_from_array(const T* array, size_t n) {                             \
+    if (!array && n > 0) return NULL;                                                         \
+    name* list = name##_create();                                                             \
+    if (!list) return NULL;                                                                   \
+    for (size_t i = 0; i < n; i++) {                                                          \
+        if (name##_insert_tail(list, array[i]) != LIST_SUCCESS) {                             \
+            name##_destroy(list);                                                             \
+            return NULL;                                                                      \
+        }                                                                                     \
+    }                                                                                         \
+    return list;                                                                              \
+}                                                                                             \
+                                                                                              \
+/* Copies the elements into a new generic LinkedList (node storage) */                        \
+static inline LinkedList* name##_to_list(const name* list) {                                  \
+    if (!list) return NULL;                                                                   \
+    LinkedList* generic = create_list(sizeof(T));                                             \
+    if (!generic) return NULL;                                                                \
+    for (name##_node* current = list->head->next; current != list->tail; current = current->next) { \
+        if (insert_tail_value_internal(generic, &current->value) != LIST_SUCCESS) {           \
+            destroy(generic);                                                                 \
+            return NULL;                                                                      \
+        }                                                                                     \
+    }                                                                                         \
+    return generic;                                                                           \
+}                                                                                             \
+                                                                                              \
+/* Copies the elements of a generic LinkedList (any storage) whose element_size is sizeof(T) */ \
+static inline name* name##_from_list(const LinkedList* list) {                                \
+    if (!list || list->element_size != sizeof(T)) return NULL;                                \
+    if (list->length == 0) return name##_create();                                            \
+    size_t n;                                                                                 \
+    T* array = to_array(list, &n);                                                            \
+    if (!array) return NULL;                                                                  \
+    name* typed = name##_from_array(array, n);                                                \
+    free(array);                                                                              \
+    return typed;                                                                             \
+}
+
+#endif
+// EOF